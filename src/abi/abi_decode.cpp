@@ -0,0 +1,275 @@
+#include "abi_decode.hpp"
+#include "duckdb/main/extension_util.hpp"
+#include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/function/scalar_function.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
+#include "keccak.hpp"
+#include "utf8proc_wrapper.hpp"
+
+namespace duckdb {
+
+static inline void WriteBlob(Vector &target, idx_t row, const uint8_t *ptr, idx_t len) {
+	FlatVector::GetData<string_t>(target)[row] = StringVector::AddStringOrBlob(target, const_char_ptr_cast(ptr), len);
+}
+
+static inline bool AllBytesEqual(const uint8_t *ptr, idx_t len, uint8_t value) {
+	for (idx_t i = 0; i < len; i++) {
+		if (ptr[i] != value) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool AbiDecoder::DecodeWord(const AbiType &type, const uint8_t *word, Vector &target, idx_t row) {
+	switch (type.id) {
+	case AbiTypeId::UINT:
+		// Narrower widths must be zero padded on the left
+		if (!AllBytesEqual(word, ABI_WORD_SIZE - type.size / 8, 0)) {
+			return false;
+		}
+		WriteBlob(target, row, word, ABI_WORD_SIZE);
+		return true;
+	case AbiTypeId::INT: {
+		// Narrower widths must be sign extended
+		const idx_t pad = ABI_WORD_SIZE - type.size / 8;
+		const uint8_t fill = (word[pad] & 0x80) ? 0xFF : 0x00;
+		if (!AllBytesEqual(word, pad, fill)) {
+			return false;
+		}
+		WriteBlob(target, row, word, ABI_WORD_SIZE);
+		return true;
+	}
+	case AbiTypeId::ADDRESS:
+		if (!AllBytesEqual(word, 12, 0)) {
+			return false;
+		}
+		WriteBlob(target, row, word + 12, 20);
+		return true;
+	case AbiTypeId::BOOL:
+		if (!AllBytesEqual(word, ABI_WORD_SIZE - 1, 0) || word[ABI_WORD_SIZE - 1] > 1) {
+			return false;
+		}
+		FlatVector::GetData<bool>(target)[row] = word[ABI_WORD_SIZE - 1] == 1;
+		return true;
+	case AbiTypeId::FIXED_BYTES:
+		// bytesN is left aligned and zero padded on the right
+		if (!AllBytesEqual(word + type.size, ABI_WORD_SIZE - type.size, 0)) {
+			return false;
+		}
+		WriteBlob(target, row, word, type.size);
+		return true;
+	default:
+		return false;
+	}
+}
+
+// Reads a word used as an offset or length, it must fit in the buffer to be meaningful
+bool AbiDecoder::ReadLength(idx_t pos, idx_t &out) const {
+	if (pos > size || size - pos < ABI_WORD_SIZE) {
+		return false;
+	}
+	const uint8_t *word = data + pos;
+	if (!AllBytesEqual(word, ABI_WORD_SIZE - sizeof(uint64_t), 0)) {
+		return false;
+	}
+	uint64_t value = 0;
+	for (idx_t i = ABI_WORD_SIZE - sizeof(uint64_t); i < ABI_WORD_SIZE; i++) {
+		value = (value << 8) | word[i];
+	}
+	if (value > size) {
+		return false;
+	}
+	out = value;
+	return true;
+}
+
+bool AbiDecoder::DecodeField(const AbiType &type, idx_t base, idx_t head, Vector &target, idx_t row) {
+	if (!type.is_dynamic) {
+		return DecodeValue(type, head, target, row);
+	}
+	idx_t offset;
+	if (!ReadLength(head, offset)) {
+		return false;
+	}
+	return DecodeValue(type, base + offset, target, row);
+}
+
+// Marks rows valid again, down through struct fields, so child rows left by a failed decode are clean when reused
+static void ResetRowValidity(Vector &target, idx_t start, idx_t count) {
+	auto &validity = FlatVector::Validity(target);
+	for (idx_t i = 0; i < count; i++) {
+		validity.SetValid(start + i);
+	}
+	if (target.GetType().InternalType() == PhysicalType::STRUCT) {
+		for (auto &entry : StructVector::GetEntries(target)) {
+			ResetRowValidity(*entry, start, count);
+		}
+	}
+}
+
+bool AbiDecoder::DecodeList(const AbiType &element, idx_t start, idx_t length, Vector &target, idx_t row) {
+	// Every element occupies at least its head, which bounds the allocation by the input size
+	if (start > size || length > (size - start) / element.head_size) {
+		return false;
+	}
+	const idx_t offset = ListVector::GetListSize(target);
+	auto &entry = FlatVector::GetData<list_entry_t>(target)[row];
+	entry.offset = offset;
+	entry.length = 0;
+	ListVector::Reserve(target, offset + length);
+	auto &child = ListVector::GetEntry(target);
+	for (idx_t i = 0; i < length; i++) {
+		if (!DecodeField(element, start, start + i * element.head_size, child, offset + i)) {
+			// The list stays empty and the next row reuses the child rows written so far
+			ResetRowValidity(child, offset, i + 1);
+			return false;
+		}
+	}
+	entry.length = length;
+	ListVector::SetListSize(target, offset + length);
+	return true;
+}
+
+bool AbiDecoder::DecodeValue(const AbiType &type, idx_t pos, Vector &target, idx_t row) {
+	switch (type.id) {
+	case AbiTypeId::BYTES:
+	case AbiTypeId::STRING: {
+		idx_t length;
+		if (!ReadLength(pos, length) || length > size - pos - ABI_WORD_SIZE) {
+			return false;
+		}
+		auto ptr = data + pos + ABI_WORD_SIZE;
+		if (type.id == AbiTypeId::STRING && !Utf8Proc::IsValid(const_char_ptr_cast(ptr), length)) {
+			// Well-formed ABI but not representable as VARCHAR
+			FlatVector::SetNull(target, row, true);
+			return true;
+		}
+		WriteBlob(target, row, ptr, length);
+		return true;
+	}
+	case AbiTypeId::ARRAY: {
+		idx_t length;
+		if (!ReadLength(pos, length)) {
+			return false;
+		}
+		return DecodeList(type.children[0], pos + ABI_WORD_SIZE, length, target, row);
+	}
+	case AbiTypeId::FIXED_ARRAY:
+		return DecodeList(type.children[0], pos, type.size, target, row);
+	case AbiTypeId::TUPLE: {
+		auto &entries = StructVector::GetEntries(target);
+		idx_t head = pos;
+		for (idx_t i = 0; i < type.children.size(); i++) {
+			if (!DecodeField(type.children[i], pos, head, *entries[i], row)) {
+				return false;
+			}
+			head += type.children[i].head_size;
+		}
+		return true;
+	}
+	default:
+		if (pos > size || size - pos < ABI_WORD_SIZE) {
+			return false;
+		}
+		return DecodeWord(type, data + pos, target, row);
+	}
+}
+
+// The signature is compiled once per query: parsed, laid out and its selector hashed
+struct AbiDecodeBindData : public FunctionData {
+	string signature;
+	AbiType tuple;
+	bool has_selector = false;
+	uint8_t selector[4] = {0};
+
+	unique_ptr<FunctionData> Copy() const override {
+		auto copy = make_uniq<AbiDecodeBindData>();
+		copy->signature = signature;
+		copy->tuple = tuple;
+		copy->has_selector = has_selector;
+		memcpy(copy->selector, selector, sizeof(selector));
+		return std::move(copy);
+	}
+
+	bool Equals(const FunctionData &other_p) const override {
+		return signature == other_p.Cast<AbiDecodeBindData>().signature;
+	}
+};
+
+static unique_ptr<FunctionData> AbiDecodeBind(ClientContext &context, ScalarFunction &bound_function,
+                                              vector<unique_ptr<Expression>> &arguments) {
+	if (!arguments[1]->IsFoldable()) {
+		throw InvalidInputException("abi_decode: signature must be a constant");
+	}
+	auto value = ExpressionExecutor::EvaluateScalar(context, *arguments[1]);
+	if (value.IsNull()) {
+		throw InvalidInputException("abi_decode: signature must not be NULL");
+	}
+
+	auto bind_data = make_uniq<AbiDecodeBindData>();
+	bind_data->signature = value.ToString();
+	auto signature = ParseAbiSignature(bind_data->signature);
+	if (signature.params.empty()) {
+		throw InvalidInputException("abi_decode: signature has no parameters to decode");
+	}
+	bind_data->tuple = signature.ToTuple();
+
+	// A named signature describes calldata, which starts with the function selector
+	if (!signature.name.empty()) {
+		auto canonical = signature.ToString();
+		uint8_t hash[32];
+		Keccak::Hash256(reinterpret_cast<const uint8_t *>(canonical.data()), canonical.size(), hash);
+		memcpy(bind_data->selector, hash, sizeof(bind_data->selector));
+		bind_data->has_selector = true;
+	}
+
+	bound_function.return_type = bind_data->tuple.GetLogicalType();
+	return std::move(bind_data);
+}
+
+static void AbiDecodeFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	auto &func_expr = state.expr.Cast<BoundFunctionExpression>();
+	auto &info = func_expr.bind_info->Cast<AbiDecodeBindData>();
+
+	auto &input = args.data[0];
+	const bool constant = input.GetVectorType() == VectorType::CONSTANT_VECTOR;
+	const idx_t count = constant ? 1 : args.size();
+
+	UnifiedVectorFormat fmt;
+	input.ToUnifiedFormat(count, fmt);
+	auto input_data = UnifiedVectorFormat::GetData<string_t>(fmt);
+
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	const idx_t skip = info.has_selector ? 4 : 0;
+	for (idx_t row = 0; row < count; row++) {
+		auto idx = fmt.sel->get_index(row);
+		if (!fmt.validity.RowIsValid(idx)) {
+			FlatVector::SetNull(result, row, true);
+			continue;
+		}
+		auto &calldata = input_data[idx];
+		auto ptr = const_data_ptr_cast(calldata.GetData());
+		const idx_t len = calldata.GetSize();
+		if (len < skip || (info.has_selector && memcmp(ptr, info.selector, skip) != 0)) {
+			// Calldata for a different function
+			FlatVector::SetNull(result, row, true);
+			continue;
+		}
+		AbiDecoder decoder(ptr + skip, len - skip);
+		if (!decoder.DecodeValue(info.tuple, 0, result, row)) {
+			FlatVector::SetNull(result, row, true);
+		}
+	}
+
+	if (constant) {
+		result.SetVectorType(VectorType::CONSTANT_VECTOR);
+	}
+}
+
+void RegisterABIDecodeFunctions(DatabaseInstance &db) {
+	ExtensionUtil::RegisterFunction(db, ScalarFunction("abi_decode", {LogicalType::BLOB, LogicalType::VARCHAR},
+	                                                   LogicalTypeId::STRUCT, AbiDecodeFunction, AbiDecodeBind));
+}
+
+} // namespace duckdb
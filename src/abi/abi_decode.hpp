@@ -0,0 +1,32 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "abi_types.hpp"
+
+namespace duckdb {
+
+// Decodes ABI-encoded values from one byte range straight into result vectors. Every read is bounds checked;
+// a malformed encoding (truncated data, out-of-range offsets, dirty padding) makes the call return false
+class AbiDecoder {
+public:
+	AbiDecoder(const uint8_t *data, idx_t size) : data(data), size(size) {
+	}
+
+	// Decodes the value whose head slot is at `head`, dynamic offsets are relative to `base`
+	bool DecodeField(const AbiType &type, idx_t base, idx_t head, Vector &target, idx_t row);
+	// Decodes the value whose encoding starts at `pos`
+	bool DecodeValue(const AbiType &type, idx_t pos, Vector &target, idx_t row);
+	// Decodes a single static value held in a 32-byte word (used for indexed event topics)
+	static bool DecodeWord(const AbiType &type, const uint8_t *word, Vector &target, idx_t row);
+
+private:
+	const uint8_t *data;
+	idx_t size;
+
+	bool ReadLength(idx_t pos, idx_t &out) const;
+	bool DecodeList(const AbiType &element, idx_t start, idx_t length, Vector &target, idx_t row);
+};
+
+void RegisterABIDecodeFunctions(DatabaseInstance &db);
+
+} // namespace duckdb
@@ -0,0 +1,657 @@
+#include "abi_encode.hpp"
+#include "abi_types.hpp"
+#include "duckdb/main/extension_util.hpp"
+#include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/function/scalar_function.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
+#include "keccak.hpp"
+
+namespace duckdb {
+
+static LogicalType AddressType() {
+	LogicalType t(LogicalTypeId::BLOB);
+	t.SetAlias("ADDRESS");
+	return t;
+}
+
+static LogicalType Bytes4Type() {
+	LogicalType t(LogicalTypeId::BLOB);
+	t.SetAlias("BYTES4");
+	return t;
+}
+
+static LogicalType Bytes32Type() {
+	LogicalType t(LogicalTypeId::BLOB);
+	t.SetAlias("BYTES32");
+	return t;
+}
+
+static LogicalType Uint256Type() {
+	LogicalType t(LogicalTypeId::BLOB);
+	t.SetAlias("UINT256");
+	return t;
+}
+
+static inline idx_t PaddedSize(idx_t len) {
+	return (len + ABI_WORD_SIZE - 1) / ABI_WORD_SIZE * ABI_WORD_SIZE;
+}
+
+static inline void StoreLength(uint8_t *out, uint64_t value) {
+	memset(out, 0, ABI_WORD_SIZE);
+	for (idx_t i = 0; i < sizeof(uint64_t); i++) {
+		out[ABI_WORD_SIZE - 1 - i] = static_cast<uint8_t>(value >> (i * 8));
+	}
+}
+
+template <class T>
+static inline void StoreBigEndian(T value, uint8_t *out) {
+	using UNSIGNED = typename std::make_unsigned<T>::type;
+	auto bits = static_cast<UNSIGNED>(value);
+	for (idx_t i = 0; i < sizeof(T); i++) {
+		out[sizeof(T) - 1 - i] = static_cast<uint8_t>(bits >> (i * 8));
+	}
+}
+
+template <>
+inline void StoreBigEndian(hugeint_t value, uint8_t *out) {
+	StoreBigEndian<int64_t>(value.upper, out);
+	StoreBigEndian<uint64_t>(value.lower, out + sizeof(uint64_t));
+}
+
+template <>
+inline void StoreBigEndian(uhugeint_t value, uint8_t *out) {
+	StoreBigEndian<uint64_t>(value.upper, out);
+	StoreBigEndian<uint64_t>(value.lower, out + sizeof(uint64_t));
+}
+
+template <class T>
+static inline bool IsNegative(const T &value) {
+	return value < T(0);
+}
+
+template <>
+inline bool IsNegative(const hugeint_t &value) {
+	return value.upper < 0;
+}
+
+template <>
+inline bool IsNegative(const uhugeint_t &) {
+	return false;
+}
+
+// Native integer -> 32-byte two's complement word, returns true for negative values
+template <class T>
+static bool StoreIntegerWord(const UnifiedVectorFormat &fmt, idx_t idx, uint8_t *word) {
+	auto value = UnifiedVectorFormat::GetData<T>(fmt)[idx];
+	const bool negative = IsNegative(value);
+	memset(word, negative ? 0xFF : 0x00, ABI_WORD_SIZE - sizeof(T));
+	StoreBigEndian<T>(value, word + ABI_WORD_SIZE - sizeof(T));
+	return negative;
+}
+
+// Loads an integer of any native width into a word. Returns false when the type is not an integer
+static bool LoadIntegerWord(PhysicalType type, const UnifiedVectorFormat &fmt, idx_t idx, uint8_t *word,
+                            bool &negative) {
+	switch (type) {
+	case PhysicalType::INT8:
+		negative = StoreIntegerWord<int8_t>(fmt, idx, word);
+		return true;
+	case PhysicalType::INT16:
+		negative = StoreIntegerWord<int16_t>(fmt, idx, word);
+		return true;
+	case PhysicalType::INT32:
+		negative = StoreIntegerWord<int32_t>(fmt, idx, word);
+		return true;
+	case PhysicalType::INT64:
+		negative = StoreIntegerWord<int64_t>(fmt, idx, word);
+		return true;
+	case PhysicalType::INT128:
+		negative = StoreIntegerWord<hugeint_t>(fmt, idx, word);
+		return true;
+	case PhysicalType::UINT8:
+		negative = StoreIntegerWord<uint8_t>(fmt, idx, word);
+		return true;
+	case PhysicalType::UINT16:
+		negative = StoreIntegerWord<uint16_t>(fmt, idx, word);
+		return true;
+	case PhysicalType::UINT32:
+		negative = StoreIntegerWord<uint32_t>(fmt, idx, word);
+		return true;
+	case PhysicalType::UINT64:
+		negative = StoreIntegerWord<uint64_t>(fmt, idx, word);
+		return true;
+	case PhysicalType::UINT128:
+		negative = StoreIntegerWord<uhugeint_t>(fmt, idx, word);
+		return true;
+	default:
+		return false;
+	}
+}
+
+static bool IsIntegerType(const LogicalType &type) {
+	return type.IsIntegral() && type.id() != LogicalTypeId::BOOLEAN;
+}
+
+// ========== abi_encode ==========
+
+// SQL type each argument is cast to before encoding. Integer parameters keep native integer arguments so that
+// negative values can reach int<N> without going through UINT256
+static LogicalType EncodeArgumentType(const AbiType &type, const LogicalType &argument) {
+	switch (type.id) {
+	case AbiTypeId::UINT:
+	case AbiTypeId::INT:
+		return IsIntegerType(argument) ? argument : Uint256Type();
+	case AbiTypeId::ADDRESS:
+		return AddressType();
+	case AbiTypeId::BOOL:
+		return LogicalType::BOOLEAN;
+	case AbiTypeId::FIXED_BYTES:
+		return type.size == 4 ? Bytes4Type() : type.size == 32 ? Bytes32Type() : LogicalType::BLOB;
+	case AbiTypeId::BYTES:
+		return LogicalType::BLOB;
+	case AbiTypeId::STRING:
+		return LogicalType::VARCHAR;
+	case AbiTypeId::ARRAY:
+	case AbiTypeId::FIXED_ARRAY: {
+		auto element = argument.id() == LogicalTypeId::LIST ? ListType::GetChildType(argument) : LogicalType::SQLNULL;
+		return LogicalType::LIST(EncodeArgumentType(type.children[0], element));
+	}
+	case AbiTypeId::TUPLE: {
+		if (argument.id() != LogicalTypeId::STRUCT || StructType::GetChildCount(argument) != type.children.size()) {
+			throw InvalidInputException("abi_encode: expected a STRUCT with %d fields for %s", type.children.size(),
+			                            type.ToString());
+		}
+		child_list_t<LogicalType> fields;
+		for (idx_t i = 0; i < type.children.size(); i++) {
+			fields.emplace_back(StructType::GetChildName(argument, i),
+			                    EncodeArgumentType(type.children[i], StructType::GetChildType(argument, i)));
+		}
+		return LogicalType::STRUCT(std::move(fields));
+	}
+	default:
+		throw InternalException("Unknown ABI type");
+	}
+}
+
+// Two passes over the same value tree: EncodedSize sizes a row so its result string can be allocated once,
+// Write then fills that string in place. Both return false on a NULL anywhere inside the value
+class AbiEncoder {
+public:
+	static bool EncodedSize(const AbiType &type, const RecursiveUnifiedVectorFormat &fmt, idx_t row, idx_t &size) {
+		auto idx = fmt.unified.sel->get_index(row);
+		if (!fmt.unified.validity.RowIsValid(idx)) {
+			return false;
+		}
+		switch (type.id) {
+		case AbiTypeId::BYTES:
+		case AbiTypeId::STRING:
+			size = ABI_WORD_SIZE + PaddedSize(UnifiedVectorFormat::GetData<string_t>(fmt.unified)[idx].GetSize());
+			return true;
+		case AbiTypeId::ARRAY:
+		case AbiTypeId::FIXED_ARRAY: {
+			auto &list = UnifiedVectorFormat::GetData<list_entry_t>(fmt.unified)[idx];
+			if (type.id == AbiTypeId::FIXED_ARRAY && list.length != type.size) {
+				throw InvalidInputException("abi_encode: expected %d elements for %s, got %d", type.size,
+				                            type.ToString(), list.length);
+			}
+			auto &element = type.children[0];
+			size = (type.id == AbiTypeId::ARRAY ? ABI_WORD_SIZE : 0) + list.length * element.head_size;
+			for (idx_t i = 0; i < list.length; i++) {
+				idx_t element_size;
+				if (!EncodedSize(element, fmt.children[0], list.offset + i, element_size)) {
+					return false;
+				}
+				size += element.is_dynamic ? element_size : 0;
+			}
+			return true;
+		}
+		case AbiTypeId::TUPLE: {
+			size = 0;
+			for (idx_t i = 0; i < type.children.size(); i++) {
+				auto &child = type.children[i];
+				idx_t child_size;
+				if (!EncodedSize(child, fmt.children[i], idx, child_size)) {
+					return false;
+				}
+				size += child.head_size + (child.is_dynamic ? child_size : 0);
+			}
+			return true;
+		}
+		default:
+			size = ABI_WORD_SIZE;
+			return true;
+		}
+	}
+
+	// Writes the encoding of one value at out and returns its size
+	static idx_t Write(const AbiType &type, const RecursiveUnifiedVectorFormat &fmt, idx_t row, uint8_t *out) {
+		auto idx = fmt.unified.sel->get_index(row);
+		switch (type.id) {
+		case AbiTypeId::BYTES:
+		case AbiTypeId::STRING: {
+			auto &value = UnifiedVectorFormat::GetData<string_t>(fmt.unified)[idx];
+			const idx_t len = value.GetSize();
+			StoreLength(out, len);
+			memcpy(out + ABI_WORD_SIZE, value.GetData(), len);
+			memset(out + ABI_WORD_SIZE + len, 0, PaddedSize(len) - len);
+			return ABI_WORD_SIZE + PaddedSize(len);
+		}
+		case AbiTypeId::ARRAY:
+		case AbiTypeId::FIXED_ARRAY: {
+			auto &list = UnifiedVectorFormat::GetData<list_entry_t>(fmt.unified)[idx];
+			idx_t prefix = 0;
+			if (type.id == AbiTypeId::ARRAY) {
+				StoreLength(out, list.length);
+				prefix = ABI_WORD_SIZE;
+			}
+			return prefix + WriteSequence(type.children[0], list.length, fmt.children[0], list.offset, out + prefix);
+		}
+		case AbiTypeId::TUPLE: {
+			uint8_t *head = out;
+			uint8_t *tail = out;
+			for (auto &child : type.children) {
+				tail += child.head_size;
+			}
+			for (idx_t i = 0; i < type.children.size(); i++) {
+				auto &child = type.children[i];
+				if (child.is_dynamic) {
+					StoreLength(head, UnsafeNumericCast<uint64_t>(tail - out));
+					tail += Write(child, fmt.children[i], idx, tail);
+				} else {
+					Write(child, fmt.children[i], idx, head);
+				}
+				head += child.head_size;
+			}
+			return UnsafeNumericCast<idx_t>(tail - out);
+		}
+		default:
+			WriteWord(type, fmt, idx, out);
+			return ABI_WORD_SIZE;
+		}
+	}
+
+private:
+	// Elements of an array are encoded like a tuple of `count` values of the same type
+	static idx_t WriteSequence(const AbiType &element, idx_t count, const RecursiveUnifiedVectorFormat &fmt,
+	                           idx_t offset, uint8_t *out) {
+		uint8_t *head = out;
+		uint8_t *tail = out + count * element.head_size;
+		for (idx_t i = 0; i < count; i++) {
+			if (element.is_dynamic) {
+				StoreLength(head, UnsafeNumericCast<uint64_t>(tail - out));
+				tail += Write(element, fmt, offset + i, tail);
+			} else {
+				Write(element, fmt, offset + i, head);
+			}
+			head += element.head_size;
+		}
+		return UnsafeNumericCast<idx_t>(tail - out);
+	}
+
+	[[noreturn]] static void OutOfRange(const AbiType &type) {
+		throw InvalidInputException("abi_encode: value out of range for %s", type.ToString());
+	}
+
+	static void WriteWord(const AbiType &type, const RecursiveUnifiedVectorFormat &fmt, idx_t idx, uint8_t *word) {
+		const auto physical = fmt.logical_type.InternalType();
+		switch (type.id) {
+		case AbiTypeId::BOOL:
+			memset(word, 0, ABI_WORD_SIZE);
+			word[ABI_WORD_SIZE - 1] = UnifiedVectorFormat::GetData<bool>(fmt.unified)[idx] ? 1 : 0;
+			return;
+		case AbiTypeId::UINT:
+		case AbiTypeId::INT: {
+			bool negative = false;
+			if (!LoadIntegerWord(physical, fmt.unified, idx, word, negative)) {
+				auto &value = UnifiedVectorFormat::GetData<string_t>(fmt.unified)[idx];
+				if (value.GetSize() != ABI_WORD_SIZE) {
+					throw InvalidInputException("Invalid uint256 size");
+				}
+				memcpy(word, value.GetData(), ABI_WORD_SIZE);
+				negative = type.id == AbiTypeId::INT && (word[0] & 0x80);
+			}
+			if (type.id == AbiTypeId::UINT && negative) {
+				OutOfRange(type);
+			}
+			// The value must survive truncation to the declared width
+			const idx_t pad = ABI_WORD_SIZE - type.size / 8;
+			const uint8_t fill = negative ? 0xFF : 0x00;
+			for (idx_t i = 0; i < pad; i++) {
+				if (word[i] != fill) {
+					OutOfRange(type);
+				}
+			}
+			if (type.id == AbiTypeId::INT && pad > 0 && ((word[pad] & 0x80) != 0) != negative) {
+				OutOfRange(type);
+			}
+			return;
+		}
+		case AbiTypeId::ADDRESS: {
+			auto &value = UnifiedVectorFormat::GetData<string_t>(fmt.unified)[idx];
+			if (value.GetSize() != 20) {
+				throw InvalidInputException("Invalid address size");
+			}
+			memset(word, 0, 12);
+			memcpy(word + 12, value.GetData(), 20);
+			return;
+		}
+		case AbiTypeId::FIXED_BYTES: {
+			auto &value = UnifiedVectorFormat::GetData<string_t>(fmt.unified)[idx];
+			if (value.GetSize() != type.size) {
+				throw InvalidInputException("abi_encode: expected %d bytes for %s, got %d", type.size, type.ToString(),
+				                            value.GetSize());
+			}
+			memcpy(word, value.GetData(), type.size);
+			memset(word + type.size, 0, ABI_WORD_SIZE - type.size);
+			return;
+		}
+		default:
+			throw InternalException("Unknown static ABI type");
+		}
+	}
+};
+
+struct AbiEncodeBindData : public FunctionData {
+	string signature;
+	AbiType tuple;
+	// Size of the parameter heads, where the first dynamic tail starts
+	idx_t heads_size = 0;
+	bool has_selector = false;
+	uint8_t selector[4] = {0};
+
+	unique_ptr<FunctionData> Copy() const override {
+		auto copy = make_uniq<AbiEncodeBindData>();
+		copy->signature = signature;
+		copy->tuple = tuple;
+		copy->heads_size = heads_size;
+		copy->has_selector = has_selector;
+		memcpy(copy->selector, selector, sizeof(selector));
+		return std::move(copy);
+	}
+
+	bool Equals(const FunctionData &other_p) const override {
+		return signature == other_p.Cast<AbiEncodeBindData>().signature;
+	}
+};
+
+static unique_ptr<FunctionData> AbiEncodeBind(ClientContext &context, ScalarFunction &bound_function,
+                                              vector<unique_ptr<Expression>> &arguments) {
+	if (!arguments[0]->IsFoldable()) {
+		throw InvalidInputException("abi_encode: signature must be a constant");
+	}
+	auto value = ExpressionExecutor::EvaluateScalar(context, *arguments[0]);
+	if (value.IsNull()) {
+		throw InvalidInputException("abi_encode: signature must not be NULL");
+	}
+
+	auto bind_data = make_uniq<AbiEncodeBindData>();
+	bind_data->signature = value.ToString();
+	auto signature = ParseAbiSignature(bind_data->signature);
+	if (signature.params.size() != arguments.size() - 1) {
+		throw InvalidInputException("abi_encode: %s expects %d arguments, got %d", signature.ToString(),
+		                            signature.params.size(), arguments.size() - 1);
+	}
+	bind_data->tuple = signature.ToTuple();
+	for (auto &param : signature.params) {
+		bind_data->heads_size += param.type.head_size;
+	}
+
+	// A named signature produces calldata, prefixed with the function selector
+	if (!signature.name.empty()) {
+		auto canonical = signature.ToString();
+		uint8_t hash[32];
+		Keccak::Hash256(reinterpret_cast<const uint8_t *>(canonical.data()), canonical.size(), hash);
+		memcpy(bind_data->selector, hash, sizeof(bind_data->selector));
+		bind_data->has_selector = true;
+	}
+
+	// Fix the argument types so the binder casts every value to what the layout expects
+	bound_function.arguments.resize(1);
+	for (idx_t i = 0; i < signature.params.size(); i++) {
+		bound_function.arguments.push_back(
+		    EncodeArgumentType(signature.params[i].type, arguments[i + 1]->return_type));
+	}
+	return std::move(bind_data);
+}
+
+static void AbiEncodeFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	auto &func_expr = state.expr.Cast<BoundFunctionExpression>();
+	auto &info = func_expr.bind_info->Cast<AbiEncodeBindData>();
+	const idx_t count = args.size();
+	const idx_t prefix = info.has_selector ? 4 : 0;
+	auto &params = info.tuple.children;
+
+	vector<RecursiveUnifiedVectorFormat> formats(params.size());
+	for (idx_t i = 0; i < params.size(); i++) {
+		Vector::RecursiveToUnifiedFormat(args.data[i + 1], count, formats[i]);
+	}
+
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto result_data = FlatVector::GetData<string_t>(result);
+	auto &validity = FlatVector::Validity(result);
+	for (idx_t row = 0; row < count; row++) {
+		// Size pass: heads are fixed by the layout, only dynamic tails depend on the row
+		idx_t size = info.heads_size;
+		bool valid = true;
+		for (idx_t i = 0; valid && i < params.size(); i++) {
+			idx_t param_size;
+			valid = AbiEncoder::EncodedSize(params[i], formats[i], row, param_size);
+			size += params[i].is_dynamic ? param_size : 0;
+		}
+		if (!valid) {
+			validity.SetInvalid(row);
+			continue;
+		}
+
+		// Write pass, straight into the result string
+		auto target = StringVector::EmptyString(result, prefix + size);
+		auto out = data_ptr_cast(target.GetDataWriteable());
+		memcpy(out, info.selector, prefix);
+		uint8_t *head = out + prefix;
+		uint8_t *tail = head + info.heads_size;
+		for (idx_t i = 0; i < params.size(); i++) {
+			if (params[i].is_dynamic) {
+				StoreLength(head, UnsafeNumericCast<uint64_t>(tail - out - prefix));
+				tail += AbiEncoder::Write(params[i], formats[i], row, tail);
+			} else {
+				AbiEncoder::Write(params[i], formats[i], row, head);
+			}
+			head += params[i].head_size;
+		}
+		target.Finalize();
+		result_data[row] = target;
+	}
+
+	if (args.AllConstant()) {
+		result.SetVectorType(VectorType::CONSTANT_VECTOR);
+	}
+}
+
+// ========== abi_encode_packed / keccak256_abi_packed ==========
+
+// Non-standard packed mode: values are concatenated at their natural width, array elements are padded to 32 bytes
+static void CheckPackable(const LogicalType &type, bool in_array) {
+	if (type.id() == LogicalTypeId::LIST) {
+		if (in_array) {
+			throw InvalidInputException("abi_encode_packed: nested arrays are not supported");
+		}
+		CheckPackable(ListType::GetChildType(type), true);
+		return;
+	}
+	if (type.id() == LogicalTypeId::BOOLEAN || IsIntegerType(type) || type.id() == LogicalTypeId::SQLNULL) {
+		return;
+	}
+	if (type.id() == LogicalTypeId::VARCHAR || type.id() == LogicalTypeId::BLOB) {
+		if (in_array && type.id() == LogicalTypeId::VARCHAR) {
+			throw InvalidInputException("abi_encode_packed: arrays of dynamic types are not supported");
+		}
+		return;
+	}
+	throw InvalidInputException("abi_encode_packed: cannot pack values of type %s", type.ToString());
+}
+
+// Fixed-size byte values that are numbers (ADDRESS, UINT256) are left padded inside array words, bytes are right padded
+static bool IsLeftPadded(const LogicalType &type) {
+	return type.HasAlias() && (type.GetAlias() == "ADDRESS" || type.GetAlias() == "UINT256");
+}
+
+struct PackedBufferSink {
+	uint8_t *out;
+	inline void Append(const uint8_t *data, idx_t len) {
+		memcpy(out, data, len);
+		out += len;
+	}
+};
+
+struct PackedSizeSink {
+	idx_t size = 0;
+	inline void Append(const uint8_t *, idx_t len) {
+		size += len;
+	}
+};
+
+struct PackedSpongeSink {
+	Keccak::Sponge sponge;
+	inline void Append(const uint8_t *data, idx_t len) {
+		sponge.absorb(data, len);
+	}
+};
+
+template <class SINK>
+static bool PackValue(const RecursiveUnifiedVectorFormat &fmt, idx_t row, bool in_array, SINK &sink) {
+	auto idx = fmt.unified.sel->get_index(row);
+	if (!fmt.unified.validity.RowIsValid(idx)) {
+		return false;
+	}
+	auto &type = fmt.logical_type;
+	uint8_t word[ABI_WORD_SIZE];
+	bool negative;
+	if (type.id() == LogicalTypeId::LIST) {
+		auto &list = UnifiedVectorFormat::GetData<list_entry_t>(fmt.unified)[idx];
+		for (idx_t i = 0; i < list.length; i++) {
+			if (!PackValue(fmt.children[0], list.offset + i, true, sink)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	if (type.id() == LogicalTypeId::BOOLEAN) {
+		memset(word, 0, ABI_WORD_SIZE);
+		word[ABI_WORD_SIZE - 1] = UnifiedVectorFormat::GetData<bool>(fmt.unified)[idx] ? 1 : 0;
+		const idx_t width = in_array ? ABI_WORD_SIZE : 1;
+		sink.Append(word + ABI_WORD_SIZE - width, width);
+		return true;
+	}
+	if (LoadIntegerWord(type.InternalType(), fmt.unified, idx, word, negative)) {
+		const idx_t width = in_array ? ABI_WORD_SIZE : GetTypeIdSize(type.InternalType());
+		sink.Append(word + ABI_WORD_SIZE - width, width);
+		return true;
+	}
+	auto &value = UnifiedVectorFormat::GetData<string_t>(fmt.unified)[idx];
+	auto data = const_data_ptr_cast(value.GetData());
+	const idx_t len = value.GetSize();
+	if (!in_array) {
+		sink.Append(data, len);
+		return true;
+	}
+	if (len > ABI_WORD_SIZE) {
+		throw InvalidInputException("abi_encode_packed: array elements must be at most 32 bytes");
+	}
+	memset(word, 0, ABI_WORD_SIZE);
+	memcpy(IsLeftPadded(type) ? word + ABI_WORD_SIZE - len : word, data, len);
+	sink.Append(word, ABI_WORD_SIZE);
+	return true;
+}
+
+static unique_ptr<FunctionData> AbiEncodePackedBind(ClientContext &context, ScalarFunction &bound_function,
+                                                    vector<unique_ptr<Expression>> &arguments) {
+	for (auto &argument : arguments) {
+		CheckPackable(argument->return_type, false);
+	}
+	return nullptr;
+}
+
+template <class OP>
+static void ExecutePacked(DataChunk &args, Vector &result) {
+	const idx_t count = args.size();
+	vector<RecursiveUnifiedVectorFormat> formats(args.ColumnCount());
+	for (idx_t i = 0; i < args.ColumnCount(); i++) {
+		Vector::RecursiveToUnifiedFormat(args.data[i], count, formats[i]);
+	}
+
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto result_data = FlatVector::GetData<string_t>(result);
+	auto &validity = FlatVector::Validity(result);
+	for (idx_t row = 0; row < count; row++) {
+		if (!OP::Operation(formats, row, result, result_data[row])) {
+			validity.SetInvalid(row);
+		}
+	}
+
+	if (args.AllConstant()) {
+		result.SetVectorType(VectorType::CONSTANT_VECTOR);
+	}
+}
+
+struct PackedEncodeOperator {
+	static bool Operation(const vector<RecursiveUnifiedVectorFormat> &formats, idx_t row, Vector &result,
+	                      string_t &target) {
+		PackedSizeSink size;
+		for (auto &fmt : formats) {
+			if (!PackValue(fmt, row, false, size)) {
+				return false;
+			}
+		}
+		target = StringVector::EmptyString(result, size.size);
+		PackedBufferSink buffer {data_ptr_cast(target.GetDataWriteable())};
+		for (auto &fmt : formats) {
+			PackValue(fmt, row, false, buffer);
+		}
+		target.Finalize();
+		return true;
+	}
+};
+
+// Absorbs each packed piece as it is produced, the preimage itself is never built
+struct PackedHashOperator {
+	static bool Operation(const vector<RecursiveUnifiedVectorFormat> &formats, idx_t row, Vector &result,
+	                      string_t &target) {
+		PackedSpongeSink sink;
+		for (auto &fmt : formats) {
+			if (!PackValue(fmt, row, false, sink)) {
+				return false;
+			}
+		}
+		alignas(64) uint8_t hash[32];
+		sink.sponge.finalize(hash);
+		target = StringVector::AddStringOrBlob(result, const_char_ptr_cast(hash), 32);
+		return true;
+	}
+};
+
+static void AbiEncodePackedFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	ExecutePacked<PackedEncodeOperator>(args, result);
+}
+
+static void Keccak256AbiPackedFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	ExecutePacked<PackedHashOperator>(args, result);
+}
+
+void RegisterABIEncodeFunctions(DatabaseInstance &db) {
+	ScalarFunction abi_encode("abi_encode", {LogicalType::VARCHAR}, LogicalType::BLOB, AbiEncodeFunction,
+	                          AbiEncodeBind);
+	abi_encode.varargs = LogicalType::ANY;
+	ExtensionUtil::RegisterFunction(db, abi_encode);
+
+	ScalarFunction abi_encode_packed("abi_encode_packed", {}, LogicalType::BLOB, AbiEncodePackedFunction,
+	                                 AbiEncodePackedBind);
+	abi_encode_packed.varargs = LogicalType::ANY;
+	ExtensionUtil::RegisterFunction(db, abi_encode_packed);
+
+	ScalarFunction keccak_packed("keccak256_abi_packed", {}, Bytes32Type(), Keccak256AbiPackedFunction,
+	                             AbiEncodePackedBind);
+	keccak_packed.varargs = LogicalType::ANY;
+	ExtensionUtil::RegisterFunction(db, keccak_packed);
+}
+
+} // namespace duckdb
@@ -0,0 +1,405 @@
+#include "abi_types.hpp"
+#include "duckdb/common/string_util.hpp"
+
+namespace duckdb {
+
+static LogicalType AddressType() {
+	LogicalType t(LogicalTypeId::BLOB);
+	t.SetAlias("ADDRESS");
+	return t;
+}
+
+static LogicalType Bytes4Type() {
+	LogicalType t(LogicalTypeId::BLOB);
+	t.SetAlias("BYTES4");
+	return t;
+}
+
+static LogicalType Bytes32Type() {
+	LogicalType t(LogicalTypeId::BLOB);
+	t.SetAlias("BYTES32");
+	return t;
+}
+
+static LogicalType Uint256Type() {
+	LogicalType t(LogicalTypeId::BLOB);
+	t.SetAlias("UINT256");
+	return t;
+}
+
+void AbiType::Finalize() {
+	switch (id) {
+	case AbiTypeId::BYTES:
+	case AbiTypeId::STRING:
+	case AbiTypeId::ARRAY:
+		is_dynamic = true;
+		head_size = ABI_WORD_SIZE;
+		break;
+	case AbiTypeId::FIXED_ARRAY:
+		is_dynamic = children[0].is_dynamic;
+		head_size = is_dynamic ? ABI_WORD_SIZE : size * children[0].head_size;
+		break;
+	case AbiTypeId::TUPLE: {
+		is_dynamic = false;
+		idx_t total = 0;
+		for (auto &child : children) {
+			is_dynamic = is_dynamic || child.is_dynamic;
+			total += child.head_size;
+		}
+		head_size = is_dynamic ? ABI_WORD_SIZE : total;
+		break;
+	}
+	default:
+		is_dynamic = false;
+		head_size = ABI_WORD_SIZE;
+		break;
+	}
+}
+
+string AbiType::ToString() const {
+	switch (id) {
+	case AbiTypeId::UINT:
+		return "uint" + std::to_string(size);
+	case AbiTypeId::INT:
+		return "int" + std::to_string(size);
+	case AbiTypeId::ADDRESS:
+		return "address";
+	case AbiTypeId::BOOL:
+		return "bool";
+	case AbiTypeId::FIXED_BYTES:
+		return "bytes" + std::to_string(size);
+	case AbiTypeId::BYTES:
+		return "bytes";
+	case AbiTypeId::STRING:
+		return "string";
+	case AbiTypeId::ARRAY:
+		return children[0].ToString() + "[]";
+	case AbiTypeId::FIXED_ARRAY:
+		return children[0].ToString() + "[" + std::to_string(size) + "]";
+	case AbiTypeId::TUPLE: {
+		string result = "(";
+		for (idx_t i = 0; i < children.size(); i++) {
+			if (i > 0) {
+				result += ",";
+			}
+			result += children[i].ToString();
+		}
+		return result + ")";
+	}
+	default:
+		throw InternalException("Unknown ABI type");
+	}
+}
+
+// Unnamed (or repeated) parameters fall back to positional names, struct field names must be unique
+static void AddField(child_list_t<LogicalType> &fields, const string &name, idx_t index, LogicalType type) {
+	bool usable = !name.empty();
+	for (auto &field : fields) {
+		usable = usable && !StringUtil::CIEquals(field.first, name);
+	}
+	fields.emplace_back(usable ? name : "arg" + std::to_string(index), std::move(type));
+}
+
+LogicalType AbiType::GetLogicalType() const {
+	switch (id) {
+	case AbiTypeId::UINT:
+	case AbiTypeId::INT:
+		// Signed values keep their 256-bit two's complement form, see sdiv/slt for signed views
+		return Uint256Type();
+	case AbiTypeId::ADDRESS:
+		return AddressType();
+	case AbiTypeId::BOOL:
+		return LogicalType::BOOLEAN;
+	case AbiTypeId::FIXED_BYTES:
+		if (size == 4) {
+			return Bytes4Type();
+		}
+		if (size == 32) {
+			return Bytes32Type();
+		}
+		return LogicalType::BLOB;
+	case AbiTypeId::BYTES:
+		return LogicalType::BLOB;
+	case AbiTypeId::STRING:
+		return LogicalType::VARCHAR;
+	case AbiTypeId::ARRAY:
+	case AbiTypeId::FIXED_ARRAY:
+		return LogicalType::LIST(children[0].GetLogicalType());
+	case AbiTypeId::TUPLE: {
+		child_list_t<LogicalType> fields;
+		for (idx_t i = 0; i < children.size(); i++) {
+			AddField(fields, names[i], i, children[i].GetLogicalType());
+		}
+		return LogicalType::STRUCT(std::move(fields));
+	}
+	default:
+		throw InternalException("Unknown ABI type");
+	}
+}
+
+string AbiSignature::ToString() const {
+	return name + ToTuple().ToString();
+}
+
+AbiType AbiSignature::ToTuple() const {
+	AbiType tuple;
+	tuple.id = AbiTypeId::TUPLE;
+	for (auto &param : params) {
+		tuple.children.push_back(param.type);
+		tuple.names.push_back(param.name);
+	}
+	tuple.Finalize();
+	return tuple;
+}
+
+LogicalType AbiParamsToStruct(const vector<AbiParam> &params) {
+	child_list_t<LogicalType> fields;
+	for (idx_t i = 0; i < params.size(); i++) {
+		AddField(fields, params[i].name, i, params[i].type.GetLogicalType());
+	}
+	return LogicalType::STRUCT(std::move(fields));
+}
+
+// Recursive descent over the human-readable signature grammar:
+//   signature := [keyword] [name] '(' [param {',' param}] ')'
+//   param     := type {modifier} [name]
+//   type      := (elementary | 'tuple'? '(' ... ')') {'[' [digits] ']'}
+class AbiSignatureParser {
+public:
+	explicit AbiSignatureParser(const string &text) : text(text) {
+	}
+
+	AbiSignature ParseSignature() {
+		AbiSignature signature;
+		SkipSpace();
+		auto word = PeekIdentifier();
+		if (word == "function" || word == "event" || word == "error") {
+			pos += word.size();
+			SkipSpace();
+		}
+		signature.name = ParseIdentifier();
+		SkipSpace();
+		signature.params = ParseParams();
+		ExpectEnd();
+		return signature;
+	}
+
+	AbiType ParseSingleType() {
+		SkipSpace();
+		auto type = ParseType();
+		ExpectEnd();
+		return type;
+	}
+
+private:
+	// Static values are never larger than a BLOB can be
+	static constexpr idx_t MAX_HEAD_SIZE = NumericLimits<uint32_t>::Maximum();
+
+	const string &text;
+	idx_t pos = 0;
+
+	[[noreturn]] void Fail(const string &message) const {
+		throw InvalidInputException("Invalid ABI signature '%s': %s", text, message);
+	}
+
+	static bool IsIdentifierChar(char c) {
+		return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_' || c == '$';
+	}
+
+	void SkipSpace() {
+		while (pos < text.size() && (text[pos] == ' ' || text[pos] == '\t' || text[pos] == '\n')) {
+			pos++;
+		}
+	}
+
+	string PeekIdentifier() const {
+		idx_t end = pos;
+		while (end < text.size() && IsIdentifierChar(text[end])) {
+			end++;
+		}
+		return text.substr(pos, end - pos);
+	}
+
+	string ParseIdentifier() {
+		auto word = PeekIdentifier();
+		pos += word.size();
+		return word;
+	}
+
+	void Expect(char c) {
+		SkipSpace();
+		if (pos >= text.size() || text[pos] != c) {
+			Fail(string("expected '") + c + "'");
+		}
+		pos++;
+	}
+
+	void ExpectEnd() {
+		SkipSpace();
+		if (pos != text.size()) {
+			Fail("unexpected trailing input");
+		}
+	}
+
+	vector<AbiParam> ParseParams() {
+		vector<AbiParam> params;
+		Expect('(');
+		SkipSpace();
+		if (pos < text.size() && text[pos] == ')') {
+			pos++;
+			return params;
+		}
+		while (true) {
+			params.push_back(ParseParam());
+			SkipSpace();
+			if (pos < text.size() && text[pos] == ',') {
+				pos++;
+				continue;
+			}
+			Expect(')');
+			return params;
+		}
+	}
+
+	AbiParam ParseParam() {
+		AbiParam param;
+		SkipSpace();
+		param.type = ParseType();
+		while (true) {
+			SkipSpace();
+			auto word = PeekIdentifier();
+			if (word.empty()) {
+				break;
+			}
+			pos += word.size();
+			if (word == "indexed") {
+				param.indexed = true;
+			} else if (word == "memory" || word == "calldata" || word == "storage" || word == "payable") {
+				continue;
+			} else if (param.name.empty()) {
+				param.name = word;
+			} else {
+				Fail("unexpected '" + word + "'");
+			}
+		}
+		return param;
+	}
+
+	AbiType ParseType() {
+		AbiType type;
+		auto word = PeekIdentifier();
+		if (word == "tuple" || word.empty()) {
+			pos += word.size();
+			type.id = AbiTypeId::TUPLE;
+			for (auto &component : ParseParams()) {
+				if (component.indexed) {
+					Fail("'indexed' is only allowed on top-level parameters");
+				}
+				type.children.push_back(std::move(component.type));
+				type.names.push_back(std::move(component.name));
+			}
+			if (type.children.empty()) {
+				Fail("empty tuples are not allowed");
+			}
+		} else {
+			pos += word.size();
+			type = ParseElementary(word);
+		}
+		type.Finalize();
+		if (type.head_size > MAX_HEAD_SIZE) {
+			Fail("static size too large");
+		}
+
+		// Array suffixes apply left to right: uint256[2][] is a dynamic array of uint256[2]
+		while (pos < text.size() && text[pos] == '[') {
+			pos++;
+			AbiType array;
+			idx_t length = 0;
+			bool fixed = false;
+			while (pos < text.size() && text[pos] >= '0' && text[pos] <= '9') {
+				length = length * 10 + static_cast<idx_t>(text[pos] - '0');
+				if (length > 1000000) {
+					Fail("array length too large");
+				}
+				fixed = true;
+				pos++;
+			}
+			if (pos >= text.size() || text[pos] != ']') {
+				Fail("expected ']'");
+			}
+			pos++;
+			if (fixed && length == 0) {
+				Fail("zero-length arrays are not allowed");
+			}
+			// Nested fixed arrays multiply their heads, keep the product from overflowing
+			if (fixed && !type.is_dynamic && type.head_size > MAX_HEAD_SIZE / length) {
+				Fail("static size too large");
+			}
+			array.id = fixed ? AbiTypeId::FIXED_ARRAY : AbiTypeId::ARRAY;
+			array.size = length;
+			array.children.push_back(std::move(type));
+			array.Finalize();
+			type = std::move(array);
+		}
+		return type;
+	}
+
+	// Parses the numeric suffix of uintN/intN/bytesN, -1 when absent
+	int64_t ParseWidth(const string &word, idx_t prefix) {
+		if (word.size() == prefix) {
+			return -1;
+		}
+		int64_t width = 0;
+		for (idx_t i = prefix; i < word.size(); i++) {
+			if (word[i] < '0' || word[i] > '9' || width > 1000) {
+				Fail("unknown type '" + word + "'");
+			}
+			width = width * 10 + (word[i] - '0');
+		}
+		return width;
+	}
+
+	AbiType ParseElementary(const string &word) {
+		AbiType type;
+		if (word == "address") {
+			type.id = AbiTypeId::ADDRESS;
+		} else if (word == "bool") {
+			type.id = AbiTypeId::BOOL;
+		} else if (word == "string") {
+			type.id = AbiTypeId::STRING;
+		} else if (word == "bytes") {
+			type.id = AbiTypeId::BYTES;
+		} else if (StringUtil::StartsWith(word, "bytes")) {
+			auto width = ParseWidth(word, 5);
+			if (width < 1 || width > 32) {
+				Fail("unknown type '" + word + "'");
+			}
+			type.id = AbiTypeId::FIXED_BYTES;
+			type.size = static_cast<idx_t>(width);
+		} else if (StringUtil::StartsWith(word, "uint") || StringUtil::StartsWith(word, "int")) {
+			const bool is_signed = word[0] == 'i';
+			auto width = ParseWidth(word, is_signed ? 3 : 4);
+			if (width == -1) {
+				width = 256;
+			}
+			if (width < 8 || width > 256 || width % 8 != 0) {
+				Fail("unknown type '" + word + "'");
+			}
+			type.id = is_signed ? AbiTypeId::INT : AbiTypeId::UINT;
+			type.size = static_cast<idx_t>(width);
+		} else {
+			Fail("unsupported type '" + word + "'");
+		}
+		return type;
+	}
+};
+
+AbiType ParseAbiType(const string &type) {
+	return AbiSignatureParser(type).ParseSingleType();
+}
+
+AbiSignature ParseAbiSignature(const string &signature) {
+	return AbiSignatureParser(signature).ParseSignature();
+}
+
+} // namespace duckdb
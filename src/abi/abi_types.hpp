@@ -0,0 +1,55 @@
+#pragma once
+
+#include "duckdb.hpp"
+
+namespace duckdb {
+
+enum class AbiTypeId : uint8_t { UINT, INT, ADDRESS, BOOL, FIXED_BYTES, BYTES, STRING, ARRAY, FIXED_ARRAY, TUPLE };
+
+static constexpr idx_t ABI_WORD_SIZE = 32;
+
+// A parsed Solidity ABI type. Layout facts (dynamic or not, head size) are computed once when the type is built,
+// so encoders and decoders never walk the type tree to find offsets
+struct AbiType {
+	AbiTypeId id;
+	// Bit width for UINT/INT, byte width for FIXED_BYTES, element count for FIXED_ARRAY
+	idx_t size = 0;
+	// Element type for ARRAY/FIXED_ARRAY, components for TUPLE
+	vector<AbiType> children;
+	// TUPLE component names, empty strings for unnamed components
+	vector<string> names;
+
+	bool is_dynamic = false;
+	idx_t head_size = ABI_WORD_SIZE;
+
+	// Computes is_dynamic and head_size, children must already be finalized
+	void Finalize();
+	// Canonical form used for selectors and topic hashes, e.g. "(uint256,address)[]"
+	string ToString() const;
+	LogicalType GetLogicalType() const;
+};
+
+struct AbiParam {
+	AbiType type;
+	string name;
+	bool indexed = false;
+};
+
+// "transfer(address to, uint256 amount)", "event Transfer(address indexed from, ...)" or "(uint256,bytes)"
+struct AbiSignature {
+	string name;
+	vector<AbiParam> params;
+
+	// Canonical signature, e.g. "transfer(address,uint256)"
+	string ToString() const;
+	// Tuple of all parameters, in declaration order
+	AbiType ToTuple() const;
+};
+
+AbiType ParseAbiType(const string &type);
+AbiSignature ParseAbiSignature(const string &signature);
+
+// STRUCT type for a list of parameters, unnamed parameters are called arg0, arg1, ...
+LogicalType AbiParamsToStruct(const vector<AbiParam> &params);
+
+} // namespace duckdb
@@ -0,0 +1,280 @@
+#include "log_decoder.hpp"
+#include "abi_decode.hpp"
+#include "abi_types.hpp"
+#include "duckdb/main/extension_util.hpp"
+#include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/function/scalar_function.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
+#include "keccak.hpp"
+#include <unordered_map>
+
+namespace duckdb {
+
+static constexpr idx_t TOPIC_SIZE = 32;
+
+// Indexed reference types are not stored in the topic, only their keccak hash is
+static bool IsHashedTopic(const AbiType &type) {
+	switch (type.id) {
+	case AbiTypeId::BYTES:
+	case AbiTypeId::STRING:
+	case AbiTypeId::ARRAY:
+	case AbiTypeId::FIXED_ARRAY:
+	case AbiTypeId::TUPLE:
+		return true;
+	default:
+		return false;
+	}
+}
+
+static inline uint64_t TopicKey(const uint8_t *topic) {
+	uint64_t key;
+	memcpy(&key, topic, sizeof(key));
+	return key;
+}
+
+struct LogEventPlan {
+	// Field of the result struct holding this event, also the value of the 'event' column
+	string field_name;
+	uint8_t topic0[TOPIC_SIZE];
+	vector<AbiParam> params;
+	// Number of topics a log of this event carries, topic0 included
+	idx_t topic_count;
+};
+
+struct DecodeLogBindData : public FunctionData {
+	vector<string> registry;
+	vector<LogEventPlan> events;
+	// First 8 bytes of topic0 -> candidate events, several when events differ only in which params are indexed
+	std::unordered_map<uint64_t, vector<idx_t>> dispatch;
+
+	unique_ptr<FunctionData> Copy() const override {
+		auto copy = make_uniq<DecodeLogBindData>();
+		copy->registry = registry;
+		copy->events = events;
+		copy->dispatch = dispatch;
+		return std::move(copy);
+	}
+
+	bool Equals(const FunctionData &other_p) const override {
+		return registry == other_p.Cast<DecodeLogBindData>().registry;
+	}
+
+	// Index of the event matching a log, or events.size() when none does
+	idx_t Lookup(const uint8_t *topic0, idx_t topic_count) const {
+		auto entry = dispatch.find(TopicKey(topic0));
+		if (entry == dispatch.end()) {
+			return events.size();
+		}
+		for (auto index : entry->second) {
+			auto &event = events[index];
+			if (event.topic_count == topic_count && memcmp(event.topic0, topic0, TOPIC_SIZE) == 0) {
+				return index;
+			}
+		}
+		return events.size();
+	}
+};
+
+static unique_ptr<FunctionData> DecodeLogBind(ClientContext &context, ScalarFunction &bound_function,
+                                              vector<unique_ptr<Expression>> &arguments) {
+	if (!arguments[2]->IsFoldable()) {
+		throw InvalidInputException("decode_log: abi_registry must be a constant list of event signatures");
+	}
+	auto value = ExpressionExecutor::EvaluateScalar(context, *arguments[2]);
+	if (value.IsNull() || ListValue::GetChildren(value).empty()) {
+		throw InvalidInputException("decode_log: abi_registry must not be empty");
+	}
+
+	auto bind_data = make_uniq<DecodeLogBindData>();
+	child_list_t<LogicalType> fields;
+	fields.emplace_back("event", LogicalType::VARCHAR);
+
+	for (auto &entry : ListValue::GetChildren(value)) {
+		if (entry.IsNull()) {
+			continue;
+		}
+		bind_data->registry.push_back(entry.ToString());
+		auto signature = ParseAbiSignature(bind_data->registry.back());
+		if (signature.name.empty()) {
+			throw InvalidInputException("decode_log: event signature '%s' has no name", bind_data->registry.back());
+		}
+
+		LogEventPlan plan;
+		auto canonical = signature.ToString();
+		Keccak::Hash256(reinterpret_cast<const uint8_t *>(canonical.data()), canonical.size(), plan.topic0);
+		plan.topic_count = 1;
+		for (auto &param : signature.params) {
+			if (!param.indexed) {
+				continue;
+			}
+			plan.topic_count++;
+			if (IsHashedTopic(param.type)) {
+				// The topic holds the hash, which decodes like a bytes32 value
+				param.type = ParseAbiType("bytes32");
+			}
+		}
+		if (plan.topic_count > 4) {
+			throw InvalidInputException("decode_log: event '%s' has more than 3 indexed parameters", canonical);
+		}
+		if (bind_data->Lookup(plan.topic0, plan.topic_count) != bind_data->events.size()) {
+			// Same event listed twice, the first entry wins
+			continue;
+		}
+
+		// Same-named events (e.g. ERC-20 and ERC-721 Transfer) need distinct result fields
+		plan.field_name = signature.name;
+		for (auto &field : fields) {
+			if (StringUtil::CIEquals(field.first, plan.field_name)) {
+				plan.field_name = signature.name + "_" + std::to_string(bind_data->events.size());
+				break;
+			}
+		}
+		fields.emplace_back(plan.field_name,
+		                    signature.params.empty() ? LogicalType::BOOLEAN : AbiParamsToStruct(signature.params));
+		plan.params = std::move(signature.params);
+
+		bind_data->dispatch[TopicKey(plan.topic0)].push_back(bind_data->events.size());
+		bind_data->events.push_back(std::move(plan));
+	}
+
+	bound_function.return_type = LogicalType::STRUCT(std::move(fields));
+	return std::move(bind_data);
+}
+
+// Marks every row of a vector NULL, struct children included
+static void SetAllNull(Vector &vector, idx_t count) {
+	FlatVector::Validity(vector).SetAllInvalid(count);
+	if (vector.GetType().InternalType() == PhysicalType::STRUCT) {
+		for (auto &child : StructVector::GetEntries(vector)) {
+			SetAllNull(*child, count);
+		}
+	}
+}
+
+static void SetValid(Vector &vector, idx_t row) {
+	FlatVector::Validity(vector).SetValid(row);
+	if (vector.GetType().InternalType() == PhysicalType::STRUCT) {
+		for (auto &child : StructVector::GetEntries(vector)) {
+			SetValid(*child, row);
+		}
+	}
+}
+
+static bool DecodeEvent(const LogEventPlan &event, const string_t *topics, const string_t &data, Vector &target,
+                        idx_t row) {
+	if (event.params.empty()) {
+		// Parameterless events carry a BOOLEAN marker field
+		FlatVector::GetData<bool>(target)[row] = true;
+		return true;
+	}
+	auto &entries = StructVector::GetEntries(target);
+	AbiDecoder decoder(const_data_ptr_cast(data.GetData()), data.GetSize());
+	idx_t topic = 1;
+	idx_t head = 0;
+	for (idx_t i = 0; i < event.params.size(); i++) {
+		auto &param = event.params[i];
+		auto &field = *entries[i];
+		if (!param.indexed) {
+			if (!decoder.DecodeField(param.type, 0, head, field, row)) {
+				return false;
+			}
+			head += param.type.head_size;
+			continue;
+		}
+		if (!AbiDecoder::DecodeWord(param.type, const_data_ptr_cast(topics[topic++].GetData()), field, row)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+static void DecodeLogFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	auto &func_expr = state.expr.Cast<BoundFunctionExpression>();
+	auto &info = func_expr.bind_info->Cast<DecodeLogBindData>();
+	const idx_t count = args.size();
+	const idx_t num_events = info.events.size();
+
+	auto &topics_vector = args.data[0];
+	UnifiedVectorFormat list_fmt, topic_fmt, data_fmt;
+	topics_vector.ToUnifiedFormat(count, list_fmt);
+	auto &topic_child = ListVector::GetEntry(topics_vector);
+	topic_child.ToUnifiedFormat(ListVector::GetListSize(topics_vector), topic_fmt);
+	args.data[1].ToUnifiedFormat(count, data_fmt);
+	auto lists = UnifiedVectorFormat::GetData<list_entry_t>(list_fmt);
+	auto topic_data = UnifiedVectorFormat::GetData<string_t>(topic_fmt);
+	auto log_data = UnifiedVectorFormat::GetData<string_t>(data_fmt);
+
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto &entries = StructVector::GetEntries(result);
+	auto event_names = FlatVector::GetData<string_t>(*entries[0]);
+	for (idx_t e = 0; e < num_events; e++) {
+		SetAllNull(*entries[e + 1], count);
+	}
+
+	// Pass 1: dispatch every row on topic0 and its topic count, gathering the row's topics contiguously
+	vector<idx_t> event_of_row(count);
+	vector<string_t> row_topics(count * 4);
+	vector<idx_t> bucket_start(num_events + 1, 0);
+	for (idx_t row = 0; row < count; row++) {
+		event_of_row[row] = num_events;
+		auto list_idx = list_fmt.sel->get_index(row);
+		auto data_idx = data_fmt.sel->get_index(row);
+		if (!list_fmt.validity.RowIsValid(list_idx) || !data_fmt.validity.RowIsValid(data_idx)) {
+			FlatVector::SetNull(result, row, true);
+			continue;
+		}
+		auto &list = lists[list_idx];
+		bool valid = list.length >= 1 && list.length <= 4;
+		for (idx_t t = 0; valid && t < list.length; t++) {
+			auto topic_idx = topic_fmt.sel->get_index(list.offset + t);
+			valid = topic_fmt.validity.RowIsValid(topic_idx) && topic_data[topic_idx].GetSize() == TOPIC_SIZE;
+			if (valid) {
+				row_topics[row * 4 + t] = topic_data[topic_idx];
+			}
+		}
+		const idx_t event = valid ? info.Lookup(const_data_ptr_cast(row_topics[row * 4].GetData()), list.length)
+		                          : num_events;
+		if (event == num_events) {
+			// Unknown event or not a log at all
+			FlatVector::SetNull(result, row, true);
+			continue;
+		}
+		event_of_row[row] = event;
+		bucket_start[event + 1]++;
+	}
+
+	// Pass 2: group rows by event so each event's plan runs over all of its rows at once
+	for (idx_t e = 0; e < num_events; e++) {
+		bucket_start[e + 1] += bucket_start[e];
+	}
+	vector<idx_t> grouped_rows(bucket_start[num_events]);
+	vector<idx_t> fill = bucket_start;
+	for (idx_t row = 0; row < count; row++) {
+		if (event_of_row[row] != num_events) {
+			grouped_rows[fill[event_of_row[row]]++] = row;
+		}
+	}
+
+	for (idx_t e = 0; e < num_events; e++) {
+		auto &event = info.events[e];
+		auto &target = *entries[e + 1];
+		auto name = string_t(event.field_name.c_str(), UnsafeNumericCast<uint32_t>(event.field_name.size()));
+		for (idx_t i = bucket_start[e]; i < bucket_start[e + 1]; i++) {
+			const idx_t row = grouped_rows[i];
+			SetValid(target, row);
+			event_names[row] = StringVector::AddString(*entries[0], name);
+			if (!DecodeEvent(event, &row_topics[row * 4], log_data[data_fmt.sel->get_index(row)], target, row)) {
+				FlatVector::SetNull(result, row, true);
+			}
+		}
+	}
+}
+
+void RegisterLogDecoderFunctions(DatabaseInstance &db) {
+	auto topics = LogicalType::LIST(LogicalType::BLOB);
+	auto registry = LogicalType::LIST(LogicalType::VARCHAR);
+	ExtensionUtil::RegisterFunction(db, ScalarFunction("decode_log", {topics, LogicalType::BLOB, registry},
+	                                                   LogicalTypeId::STRUCT, DecodeLogFunction, DecodeLogBind));
+}
+
+} // namespace duckdb
@@ -0,0 +1,275 @@
+#include "selector_lookup.hpp"
+#include "duckdb/main/extension_util.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/function/scalar_function.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
+#include "keccak.hpp"
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+
+namespace duckdb {
+
+static LogicalType Bytes4Type() {
+	LogicalType t(LogicalTypeId::BLOB);
+	t.SetAlias("BYTES4");
+	return t;
+}
+
+static constexpr const char *SELECTOR_DICTIONARY_SETTING = "selector_dictionary_path";
+
+using FileTimestamp = decltype(std::declval<FileSystem &>().GetLastModifiedTime(std::declval<FileHandle &>()));
+
+// Immutable selector -> signatures index. Entries are sorted by selector so a lookup is a binary search over a
+// flat uint32 array, colliding selectors simply occupy adjacent entries
+struct SelectorDictionary {
+	vector<uint32_t> selectors;
+	vector<uint32_t> offsets;
+	vector<uint32_t> lengths;
+	// All signatures back to back, lookup results point straight into it
+	string pool;
+
+	idx_t file_size = 0;
+	FileTimestamp modified {};
+};
+
+// Keeps the dictionary alive for as long as result strings point into its pool
+class SelectorDictionaryBuffer : public VectorBuffer {
+public:
+	explicit SelectorDictionaryBuffer(shared_ptr<SelectorDictionary> dictionary_p)
+	    : VectorBuffer(VectorBufferType::OPAQUE_BUFFER), dictionary(std::move(dictionary_p)) {
+	}
+
+private:
+	shared_ptr<SelectorDictionary> dictionary;
+};
+
+static inline uint32_t LoadSelector(const uint8_t *bytes) {
+	return (uint32_t(bytes[0]) << 24) | (uint32_t(bytes[1]) << 16) | (uint32_t(bytes[2]) << 8) | uint32_t(bytes[3]);
+}
+
+static inline bool IsSpace(char c) {
+	return c == ' ' || c == '\t' || c == '\r' || c == ',';
+}
+
+// Reads "0xa9059cbb" at the start of a line, false when the line is a bare signature
+static bool ParsePrefixedSelector(const char *p, idx_t len, uint32_t &selector) {
+	if (len < 11 || p[0] != '0' || (p[1] != 'x' && p[1] != 'X') || !IsSpace(p[10])) {
+		return false;
+	}
+	uint32_t value = 0;
+	for (idx_t i = 2; i < 10; i++) {
+		const char c = p[i];
+		uint32_t digit;
+		if (c >= '0' && c <= '9') {
+			digit = c - '0';
+		} else if (c >= 'a' && c <= 'f') {
+			digit = c - 'a' + 10;
+		} else if (c >= 'A' && c <= 'F') {
+			digit = c - 'A' + 10;
+		} else {
+			return false;
+		}
+		value = (value << 4) | digit;
+	}
+	selector = value;
+	return true;
+}
+
+// One signature per line, either "transfer(address,uint256)" or "0xa9059cbb transfer(address,uint256)" as found
+// in selector directory dumps. Blank lines and lines starting with '#' are skipped
+static void BuildSelectorDictionary(const string &contents, SelectorDictionary &dictionary) {
+	struct Entry {
+		uint32_t selector;
+		uint32_t offset;
+		uint32_t length;
+	};
+	if (contents.size() > NumericLimits<uint32_t>::Maximum()) {
+		throw InvalidInputException("lookup_selector: signature file is too large");
+	}
+	vector<Entry> entries;
+	const char *data = contents.data();
+	idx_t pos = 0;
+	while (pos < contents.size()) {
+		idx_t end = pos;
+		while (end < contents.size() && data[end] != '\n') {
+			end++;
+		}
+		idx_t start = pos;
+		idx_t stop = end;
+		pos = end + 1;
+		while (start < stop && IsSpace(data[start])) {
+			start++;
+		}
+		while (stop > start && IsSpace(data[stop - 1])) {
+			stop--;
+		}
+		if (start == stop || data[start] == '#') {
+			continue;
+		}
+
+		uint32_t selector;
+		if (ParsePrefixedSelector(data + start, stop - start, selector)) {
+			start += 10;
+			while (start < stop && IsSpace(data[start])) {
+				start++;
+			}
+		} else {
+			uint8_t hash[32];
+			Keccak::Hash256(reinterpret_cast<const uint8_t *>(data + start), stop - start, hash);
+			selector = LoadSelector(hash);
+		}
+		entries.push_back({selector, static_cast<uint32_t>(start), static_cast<uint32_t>(stop - start)});
+	}
+
+	auto signature_less = [&](const Entry &a, const Entry &b) {
+		if (a.selector != b.selector) {
+			return a.selector < b.selector;
+		}
+		return contents.compare(a.offset, a.length, contents, b.offset, b.length) < 0;
+	};
+	std::sort(entries.begin(), entries.end(), signature_less);
+
+	for (idx_t i = 0; i < entries.size(); i++) {
+		auto &entry = entries[i];
+		if (i > 0 && !signature_less(entries[i - 1], entry)) {
+			// Same signature listed twice
+			continue;
+		}
+		dictionary.selectors.push_back(entry.selector);
+		dictionary.offsets.push_back(static_cast<uint32_t>(dictionary.pool.size()));
+		dictionary.lengths.push_back(entry.length);
+		dictionary.pool.append(data + entry.offset, entry.length);
+	}
+}
+
+// Dictionaries are built once per process and shared by every query, rebuilt only when the file changes
+static shared_ptr<SelectorDictionary> GetSelectorDictionary(ClientContext &context, const string &path) {
+	static std::mutex cache_lock;
+	static std::unordered_map<string, shared_ptr<SelectorDictionary>> cache;
+
+	auto &fs = FileSystem::GetFileSystem(context);
+	auto handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_READ);
+	const idx_t file_size = handle->GetFileSize();
+	const auto modified = fs.GetLastModifiedTime(*handle);
+
+	std::lock_guard<std::mutex> guard(cache_lock);
+	auto entry = cache.find(path);
+	if (entry != cache.end() && entry->second->file_size == file_size && entry->second->modified == modified) {
+		return entry->second;
+	}
+
+	string contents(file_size, '\0');
+	if (file_size > 0) {
+		handle->Read(const_cast<char *>(contents.data()), file_size, 0);
+	}
+	auto dictionary = make_shared_ptr<SelectorDictionary>();
+	BuildSelectorDictionary(contents, *dictionary);
+	dictionary->file_size = file_size;
+	dictionary->modified = modified;
+	cache[path] = dictionary;
+	return dictionary;
+}
+
+struct LookupSelectorBindData : public FunctionData {
+	string path;
+	shared_ptr<SelectorDictionary> dictionary;
+
+	unique_ptr<FunctionData> Copy() const override {
+		auto copy = make_uniq<LookupSelectorBindData>();
+		copy->path = path;
+		copy->dictionary = dictionary;
+		return std::move(copy);
+	}
+
+	bool Equals(const FunctionData &other_p) const override {
+		return dictionary == other_p.Cast<LookupSelectorBindData>().dictionary;
+	}
+};
+
+static unique_ptr<FunctionData> LookupSelectorBind(ClientContext &context, ScalarFunction &bound_function,
+                                                   vector<unique_ptr<Expression>> &arguments) {
+	auto bind_data = make_uniq<LookupSelectorBindData>();
+	Value path;
+	if (arguments.size() > 1) {
+		if (!arguments[1]->IsFoldable()) {
+			throw InvalidInputException("lookup_selector: dictionary path must be a constant");
+		}
+		path = ExpressionExecutor::EvaluateScalar(context, *arguments[1]);
+	} else {
+		context.TryGetCurrentSetting(SELECTOR_DICTIONARY_SETTING, path);
+	}
+	if (path.IsNull() || path.ToString().empty()) {
+		throw InvalidInputException("lookup_selector: no signature file, SET %s = '<path>' first",
+		                            SELECTOR_DICTIONARY_SETTING);
+	}
+	bind_data->path = path.ToString();
+	// First use loads (or reuses) the dictionary, execution only probes it
+	bind_data->dictionary = GetSelectorDictionary(context, bind_data->path);
+	return std::move(bind_data);
+}
+
+static void LookupSelectorFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	auto &func_expr = state.expr.Cast<BoundFunctionExpression>();
+	auto &info = func_expr.bind_info->Cast<LookupSelectorBindData>();
+	auto &dictionary = *info.dictionary;
+	const idx_t count = args.size();
+
+	UnifiedVectorFormat fmt;
+	args.data[0].ToUnifiedFormat(count, fmt);
+	auto inputs = UnifiedVectorFormat::GetData<string_t>(fmt);
+
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto list_data = FlatVector::GetData<list_entry_t>(result);
+	auto &validity = FlatVector::Validity(result);
+	auto &child = ListVector::GetEntry(result);
+	StringVector::AddBuffer(child, make_buffer<SelectorDictionaryBuffer>(info.dictionary));
+
+	auto begin = dictionary.selectors.begin();
+	auto end = dictionary.selectors.end();
+	for (idx_t row = 0; row < count; row++) {
+		auto idx = fmt.sel->get_index(row);
+		if (!fmt.validity.RowIsValid(idx) || inputs[idx].GetSize() != 4) {
+			validity.SetInvalid(row);
+			continue;
+		}
+		const auto selector = LoadSelector(const_data_ptr_cast(inputs[idx].GetData()));
+		auto range = std::equal_range(begin, end, selector);
+		const idx_t first = NumericCast<idx_t>(range.first - begin);
+		const idx_t matches = NumericCast<idx_t>(range.second - range.first);
+
+		const idx_t offset = ListVector::GetListSize(result);
+		ListVector::Reserve(result, offset + matches);
+		auto child_data = FlatVector::GetData<string_t>(ListVector::GetEntry(result));
+		for (idx_t i = 0; i < matches; i++) {
+			// Points into the shared pool, which the buffer added above keeps alive
+			child_data[offset + i] = string_t(dictionary.pool.data() + dictionary.offsets[first + i],
+			                                  dictionary.lengths[first + i]);
+		}
+		list_data[row].offset = offset;
+		list_data[row].length = matches;
+		ListVector::SetListSize(result, offset + matches);
+	}
+
+	if (args.AllConstant()) {
+		result.SetVectorType(VectorType::CONSTANT_VECTOR);
+	}
+}
+
+void RegisterSelectorLookupFunctions(DatabaseInstance &db) {
+	auto &config = DBConfig::GetConfig(db);
+	config.AddExtensionOption(SELECTOR_DICTIONARY_SETTING,
+	                          "Signature list used by lookup_selector, one signature per line", LogicalType::VARCHAR,
+	                          Value(""));
+
+	auto result_type = LogicalType::LIST(LogicalType::VARCHAR);
+	ScalarFunctionSet lookup("lookup_selector");
+	lookup.AddFunction(ScalarFunction({Bytes4Type()}, result_type, LookupSelectorFunction, LookupSelectorBind));
+	lookup.AddFunction(ScalarFunction({Bytes4Type(), LogicalType::VARCHAR}, result_type, LookupSelectorFunction,
+	                                  LookupSelectorBind));
+	ExtensionUtil::RegisterFunction(db, lookup);
+}
+
+} // namespace duckdb
@@ -1,6 +1,7 @@
 #include "duckdb/main/extension_util.hpp"
 #include "duckdb/common/vector_operations/unary_executor.hpp"
 #include "duckdb/function/scalar_function.hpp"
+#include "duckdb/common/string_map_set.hpp"
 #include "keccak.hpp"
 #include "selectors.hpp"
 #include "yyjson.hpp"
@@ -19,75 +20,129 @@ static LogicalType Bytes32Type() {
 	return t;
 }
 
-static size_t BuildSignatureFromJson(const char *json_str, size_t json_len, char *buffer) {
-	using duckdb_yyjson::yyjson_doc;
-	using duckdb_yyjson::yyjson_doc_free;
-	using duckdb_yyjson::yyjson_doc_get_root;
-	using duckdb_yyjson::yyjson_get_str;
-	using duckdb_yyjson::yyjson_is_arr;
-	using duckdb_yyjson::yyjson_is_str;
-	using duckdb_yyjson::yyjson_obj_get;
-	using duckdb_yyjson::yyjson_read;
-	using duckdb_yyjson::yyjson_val;
-	size_t offset = 0;
+using duckdb_yyjson::yyjson_doc;
+using duckdb_yyjson::yyjson_doc_free;
+using duckdb_yyjson::yyjson_doc_get_root;
+using duckdb_yyjson::yyjson_get_len;
+using duckdb_yyjson::yyjson_get_str;
+using duckdb_yyjson::yyjson_is_arr;
+using duckdb_yyjson::yyjson_is_obj;
+using duckdb_yyjson::yyjson_is_str;
+using duckdb_yyjson::yyjson_obj_get;
+using duckdb_yyjson::yyjson_read;
+using duckdb_yyjson::yyjson_val;
 
-	yyjson_doc *doc = yyjson_read(json_str, json_len, 0);
-	if (!doc) {
-		throw InvalidInputException("Invalid ABI JSON");
+// Owns a parsed document so every exit path frees it
+class AbiJsonDocument {
+public:
+	AbiJsonDocument(const char *json, size_t len) : doc(yyjson_read(json, len, 0)) {
+		if (!doc) {
+			throw InvalidInputException("Invalid ABI JSON");
+		}
+	}
+	~AbiJsonDocument() {
+		yyjson_doc_free(doc);
+	}
+	yyjson_val *Root() const {
+		return yyjson_doc_get_root(doc);
 	}
 
-	yyjson_val *root = yyjson_doc_get_root(doc);
+private:
+	yyjson_doc *doc;
+};
 
-	yyjson_val *name = yyjson_obj_get(root, "name");
-	if (!name || !yyjson_is_str(name)) {
-		yyjson_doc_free(doc);
-		throw InvalidInputException("Invalid ABI JSON: missing 'name' field");
+static bool GetJsonString(yyjson_val *obj, const char *key, const char *&str, size_t &len) {
+	yyjson_val *val = yyjson_obj_get(obj, key);
+	if (!val || !yyjson_is_str(val)) {
+		return false;
 	}
+	str = yyjson_get_str(val);
+	len = yyjson_get_len(val);
+	return true;
+}
 
-	const char *name_str = yyjson_get_str(name);
-	size_t name_len = strlen(name_str);
-	memcpy(buffer + offset, name_str, name_len);
-	offset += name_len;
-	buffer[offset++] = '(';
+// Appends the canonical type of one ABI parameter. Tuples are expanded from their components recursively,
+// so "tuple[]" with components [uint256, address] becomes "(uint256,address)[]"
+static void AppendCanonicalType(yyjson_val *param, string &out) {
+	const char *type;
+	size_t type_len;
+	if (!yyjson_is_obj(param) || !GetJsonString(param, "type", type, type_len)) {
+		throw InvalidInputException("Invalid ABI JSON: parameter without 'type'");
+	}
+	if (type_len >= 5 && memcmp(type, "tuple", 5) == 0) {
+		yyjson_val *components = yyjson_obj_get(param, "components");
+		if (!components || !yyjson_is_arr(components)) {
+			throw InvalidInputException("Invalid ABI JSON: tuple without 'components'");
+		}
+		out += '(';
+		size_t idx, max;
+		yyjson_val *component;
+		yyjson_arr_foreach(components, idx, max, component) {
+			if (idx > 0) {
+				out += ',';
+			}
+			AppendCanonicalType(component, out);
+		}
+		out += ')';
+		out.append(type + 5, type_len - 5);
+		return;
+	}
+	out.append(type, type_len);
+	// "uint"/"int" (optionally followed by array suffixes) are aliases of the 256-bit types
+	size_t base_len = 0;
+	if (type_len >= 4 && memcmp(type, "uint", 4) == 0) {
+		base_len = 4;
+	} else if (type_len >= 3 && memcmp(type, "int", 3) == 0) {
+		base_len = 3;
+	}
+	if (base_len > 0 && (type_len == base_len || type[base_len] == '[')) {
+		out.insert(out.size() - (type_len - base_len), "256");
+	}
+}
 
-	yyjson_val *inputs = yyjson_obj_get(root, "inputs");
+// Canonical "name(type,...)" for one ABI entry, written into a reusable growable buffer
+static void BuildSignatureFromJson(yyjson_val *entry, string &signature) {
+	const char *name;
+	size_t name_len;
+	if (!yyjson_is_obj(entry) || !GetJsonString(entry, "name", name, name_len)) {
+		throw InvalidInputException("Invalid ABI JSON: missing 'name' field");
+	}
+	signature.assign(name, name_len);
+	signature += '(';
+	yyjson_val *inputs = yyjson_obj_get(entry, "inputs");
 	if (inputs && yyjson_is_arr(inputs)) {
 		size_t idx, max;
 		yyjson_val *input;
-		bool first = true;
-
 		yyjson_arr_foreach(inputs, idx, max, input) {
-			yyjson_val *type = yyjson_obj_get(input, "type");
-			if (type && yyjson_is_str(type)) {
-				if (!first) {
-					buffer[offset++] = ',';
-				}
-				first = false;
-
-				const char *type_str = yyjson_get_str(type);
-				size_t type_len = strlen(type_str);
-				memcpy(buffer + offset, type_str, type_len);
-				offset += type_len;
+			if (idx > 0) {
+				signature += ',';
 			}
+			AppendCanonicalType(input, signature);
 		}
 	}
-
-	buffer[offset++] = ')';
-	buffer[offset] = '\0';
-	yyjson_doc_free(doc);
-	return offset;
+	signature += ')';
 }
 
 template <size_t RESULT_SIZE>
 static void ProcessAbiJson(DataChunk &args, ExpressionState &state, Vector &result) {
+	// The same ABI entries repeat across rows (standard tokens, proxies, clones), each distinct JSON is parsed
+	// and hashed once per chunk
+	string_map_t<string_t> cache;
+	string signature;
 	UnaryExecutor::Execute<string_t, string_t>(args.data[0], result, args.size(), [&](const string_t &abi_json) {
-		char signature_buffer[1024] = {0};
-		size_t sig_len = BuildSignatureFromJson(abi_json.GetData(), abi_json.GetSize(), signature_buffer);
+		auto cached = cache.find(abi_json);
+		if (cached != cache.end()) {
+			return cached->second;
+		}
+		AbiJsonDocument doc(abi_json.GetData(), abi_json.GetSize());
+		BuildSignatureFromJson(doc.Root(), signature);
 
 		alignas(64) uint8_t hash[32];
-		Keccak::Hash256(reinterpret_cast<const uint8_t *>(signature_buffer), sig_len, hash);
+		Keccak::Hash256(reinterpret_cast<const uint8_t *>(signature.data()), signature.size(), hash);
 
-		return StringVector::AddStringOrBlob(result, const_char_ptr_cast(hash), RESULT_SIZE);
+		auto value = StringVector::AddStringOrBlob(result, const_char_ptr_cast(hash), RESULT_SIZE);
+		cache.emplace(abi_json, value);
+		return value;
 	});
 }
 
@@ -124,6 +179,122 @@ static void ErrorSelectorFromString(DataChunk &args, ExpressionState &state, Vec
 	ProcessSignatureString<4>(args, state, result);
 }
 
+static LogicalType AbiEntryType() {
+	child_list_t<LogicalType> fields;
+	fields.emplace_back("type", LogicalType::VARCHAR);
+	fields.emplace_back("name", LogicalType::VARCHAR);
+	fields.emplace_back("signature", LogicalType::VARCHAR);
+	fields.emplace_back("selector", Bytes4Type());
+	fields.emplace_back("topic0", Bytes32Type());
+	return LogicalType::STRUCT(std::move(fields));
+}
+
+enum class AbiEntryKind : uint8_t { FUNCTION, EVENT, ERROR, OTHER };
+
+static AbiEntryKind GetEntryKind(yyjson_val *entry) {
+	const char *type;
+	size_t type_len;
+	if (!GetJsonString(entry, "type", type, type_len)) {
+		// The ABI spec defaults a missing type to "function"
+		return AbiEntryKind::FUNCTION;
+	}
+	if (type_len == 8 && memcmp(type, "function", 8) == 0) {
+		return AbiEntryKind::FUNCTION;
+	}
+	if (type_len == 5 && memcmp(type, "event", 5) == 0) {
+		return AbiEntryKind::EVENT;
+	}
+	if (type_len == 5 && memcmp(type, "error", 5) == 0) {
+		return AbiEntryKind::ERROR;
+	}
+	return AbiEntryKind::OTHER;
+}
+
+static void AppendAbiEntry(Vector &list, AbiEntryKind kind, const string &signature) {
+	const idx_t index = ListVector::GetListSize(list);
+	ListVector::Reserve(list, index + 1);
+	auto &fields = StructVector::GetEntries(ListVector::GetEntry(list));
+
+	alignas(64) uint8_t hash[32];
+	Keccak::Hash256(reinterpret_cast<const uint8_t *>(signature.data()), signature.size(), hash);
+
+	const char *type = kind == AbiEntryKind::EVENT ? "event" : kind == AbiEntryKind::ERROR ? "error" : "function";
+	FlatVector::GetData<string_t>(*fields[0])[index] = StringVector::AddString(*fields[0], type);
+	FlatVector::GetData<string_t>(*fields[1])[index] =
+	    StringVector::AddString(*fields[1], signature.data(), signature.find('('));
+	FlatVector::GetData<string_t>(*fields[2])[index] = StringVector::AddString(*fields[2], signature);
+	if (kind == AbiEntryKind::EVENT) {
+		FlatVector::SetNull(*fields[3], index, true);
+		FlatVector::GetData<string_t>(*fields[4])[index] =
+		    StringVector::AddStringOrBlob(*fields[4], const_char_ptr_cast(hash), 32);
+	} else {
+		FlatVector::GetData<string_t>(*fields[3])[index] =
+		    StringVector::AddStringOrBlob(*fields[3], const_char_ptr_cast(hash), 4);
+		FlatVector::SetNull(*fields[4], index, true);
+	}
+	ListVector::SetListSize(list, index + 1);
+}
+
+// One list element per function, event and error of a full ABI (or of a single entry object)
+static void AbiEntriesFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	const idx_t count = args.size();
+	UnifiedVectorFormat fmt;
+	args.data[0].ToUnifiedFormat(count, fmt);
+	auto inputs = UnifiedVectorFormat::GetData<string_t>(fmt);
+
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto list_data = FlatVector::GetData<list_entry_t>(result);
+	auto &validity = FlatVector::Validity(result);
+
+	// Rows holding the same ABI share one range of list entries
+	string_map_t<list_entry_t> cache;
+	string signature;
+	for (idx_t row = 0; row < count; row++) {
+		auto idx = fmt.sel->get_index(row);
+		if (!fmt.validity.RowIsValid(idx)) {
+			validity.SetInvalid(row);
+			continue;
+		}
+		auto &abi_json = inputs[idx];
+		auto cached = cache.find(abi_json);
+		if (cached != cache.end()) {
+			list_data[row] = cached->second;
+			continue;
+		}
+
+		AbiJsonDocument doc(abi_json.GetData(), abi_json.GetSize());
+		yyjson_val *root = doc.Root();
+		const idx_t offset = ListVector::GetListSize(result);
+		auto add_entry = [&](yyjson_val *entry) {
+			if (!yyjson_is_obj(entry) || !yyjson_obj_get(entry, "name")) {
+				return;
+			}
+			auto kind = GetEntryKind(entry);
+			if (kind == AbiEntryKind::OTHER) {
+				return;
+			}
+			BuildSignatureFromJson(entry, signature);
+			AppendAbiEntry(result, kind, signature);
+		};
+		if (yyjson_is_arr(root)) {
+			size_t i, max;
+			yyjson_val *entry;
+			yyjson_arr_foreach(root, i, max, entry) {
+				add_entry(entry);
+			}
+		} else {
+			add_entry(root);
+		}
+		list_data[row].offset = offset;
+		list_data[row].length = ListVector::GetListSize(result) - offset;
+		cache.emplace(abi_json, list_data[row]);
+	}
+
+	if (args.AllConstant()) {
+		result.SetVectorType(VectorType::CONSTANT_VECTOR);
+	}
+}
+
 void RegisterABISelectorFunctions(DatabaseInstance &db) {
 	ExtensionUtil::RegisterFunction(db,
 	                                ScalarFunction("event_signature_json", vector<LogicalType> {LogicalType::JSON()},
@@ -144,6 +315,9 @@ void RegisterABISelectorFunctions(DatabaseInstance &db) {
 
 	ExtensionUtil::RegisterFunction(db, ScalarFunction("error_selector", vector<LogicalType> {LogicalType::VARCHAR},
 	                                                   Bytes4Type(), ErrorSelectorFromString));
+
+	ExtensionUtil::RegisterFunction(db, ScalarFunction("abi_entries", vector<LogicalType> {LogicalType::JSON()},
+	                                                   LogicalType::LIST(AbiEntryType()), AbiEntriesFunction));
 }
 
 } // namespace duckdb
@@ -0,0 +1,233 @@
+#include "logs_bloom.hpp"
+#include "duckdb/main/extension_util.hpp"
+#include "duckdb/common/vector_operations/binary_executor.hpp"
+#include "duckdb/common/vector_operations/unary_executor.hpp"
+#include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/function/aggregate_function.hpp"
+#include "duckdb/function/scalar_function.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
+#include "keccak.hpp"
+
+namespace duckdb {
+
+static LogicalType AddressType() {
+	LogicalType t(LogicalTypeId::BLOB);
+	t.SetAlias("ADDRESS");
+	return t;
+}
+
+static LogicalType Bytes32Type() {
+	LogicalType t(LogicalTypeId::BLOB);
+	t.SetAlias("BYTES32");
+	return t;
+}
+
+static constexpr idx_t BLOOM_SIZE = 256;
+static constexpr idx_t BLOOM_PROBES = 3;
+
+// A value sets three bits of the 2048-bit bloom, each taken from a pair of bytes of its keccak hash
+struct BloomProbe {
+	uint8_t byte[BLOOM_PROBES];
+	uint8_t mask[BLOOM_PROBES];
+
+	explicit BloomProbe(const string_t &value) {
+		uint8_t hash[32];
+		Keccak::Hash256(const_data_ptr_cast(value.GetData()), value.GetSize(), hash);
+		for (idx_t i = 0; i < BLOOM_PROBES; i++) {
+			const uint32_t bit = ((uint32_t(hash[i * 2]) << 8) | hash[i * 2 + 1]) & 2047;
+			byte[i] = uint8_t(BLOOM_SIZE - 1 - bit / 8);
+			mask[i] = uint8_t(1 << (bit % 8));
+		}
+	}
+
+	inline void AddTo(uint8_t *bloom) const {
+		for (idx_t i = 0; i < BLOOM_PROBES; i++) {
+			bloom[byte[i]] |= mask[i];
+		}
+	}
+
+	inline bool MayBeIn(const uint8_t *bloom) const {
+		for (idx_t i = 0; i < BLOOM_PROBES; i++) {
+			if (!(bloom[byte[i]] & mask[i])) {
+				return false;
+			}
+		}
+		return true;
+	}
+};
+
+struct LogsBloomState {
+	uint8_t bits[BLOOM_SIZE];
+	bool is_set;
+};
+
+struct LogsBloomOperation {
+	template <class STATE>
+	static void Initialize(STATE &state) {
+		memset(state.bits, 0, BLOOM_SIZE);
+		state.is_set = false;
+	}
+
+	template <class STATE, class OP>
+	static void Combine(const STATE &source, STATE &target, AggregateInputData &) {
+		for (idx_t i = 0; i < BLOOM_SIZE; i++) {
+			target.bits[i] |= source.bits[i];
+		}
+		target.is_set = target.is_set || source.is_set;
+	}
+
+	template <class T, class STATE>
+	static void Finalize(STATE &state, T &target, AggregateFinalizeData &finalize_data) {
+		if (!state.is_set) {
+			finalize_data.ReturnNull();
+			return;
+		}
+		target = StringVector::AddStringOrBlob(finalize_data.result, const_char_ptr_cast(state.bits), BLOOM_SIZE);
+	}
+
+	static bool IgnoreNull() {
+		return false;
+	}
+};
+
+// Adds one log (its address and every topic) to the state. NULL addresses and topics contribute nothing
+static inline void AddLogToBloom(LogsBloomState &state, const UnifiedVectorFormat &address_fmt,
+                                 const UnifiedVectorFormat &topics_fmt, const UnifiedVectorFormat &topic_fmt,
+                                 idx_t row) {
+	state.is_set = true;
+	auto address_idx = address_fmt.sel->get_index(row);
+	if (address_fmt.validity.RowIsValid(address_idx)) {
+		BloomProbe(UnifiedVectorFormat::GetData<string_t>(address_fmt)[address_idx]).AddTo(state.bits);
+	}
+	auto topics_idx = topics_fmt.sel->get_index(row);
+	if (!topics_fmt.validity.RowIsValid(topics_idx)) {
+		return;
+	}
+	auto &list = UnifiedVectorFormat::GetData<list_entry_t>(topics_fmt)[topics_idx];
+	auto topics = UnifiedVectorFormat::GetData<string_t>(topic_fmt);
+	for (idx_t i = 0; i < list.length; i++) {
+		auto topic_idx = topic_fmt.sel->get_index(list.offset + i);
+		if (topic_fmt.validity.RowIsValid(topic_idx)) {
+			BloomProbe(topics[topic_idx]).AddTo(state.bits);
+		}
+	}
+}
+
+static void LogsBloomUpdate(Vector inputs[], AggregateInputData &, idx_t input_count, Vector &states, idx_t count) {
+	UnifiedVectorFormat address_fmt, topics_fmt, topic_fmt, state_fmt;
+	inputs[0].ToUnifiedFormat(count, address_fmt);
+	inputs[1].ToUnifiedFormat(count, topics_fmt);
+	auto &topic_child = ListVector::GetEntry(inputs[1]);
+	topic_child.ToUnifiedFormat(ListVector::GetListSize(inputs[1]), topic_fmt);
+	states.ToUnifiedFormat(count, state_fmt);
+	auto state_ptrs = UnifiedVectorFormat::GetData<LogsBloomState *>(state_fmt);
+
+	for (idx_t row = 0; row < count; row++) {
+		AddLogToBloom(*state_ptrs[state_fmt.sel->get_index(row)], address_fmt, topics_fmt, topic_fmt, row);
+	}
+}
+
+static void LogsBloomSimpleUpdate(Vector inputs[], AggregateInputData &, idx_t input_count, data_ptr_t state_p,
+                                  idx_t count) {
+	UnifiedVectorFormat address_fmt, topics_fmt, topic_fmt;
+	inputs[0].ToUnifiedFormat(count, address_fmt);
+	inputs[1].ToUnifiedFormat(count, topics_fmt);
+	auto &topic_child = ListVector::GetEntry(inputs[1]);
+	topic_child.ToUnifiedFormat(ListVector::GetListSize(inputs[1]), topic_fmt);
+
+	auto &state = *reinterpret_cast<LogsBloomState *>(state_p);
+	for (idx_t row = 0; row < count; row++) {
+		AddLogToBloom(state, address_fmt, topics_fmt, topic_fmt, row);
+	}
+}
+
+// Probes for a constant value are hashed once at bind, which is the common case when pruning blocks for one
+// contract or event
+struct BloomMayContainBindData : public FunctionData {
+	bool has_probe = false;
+	// The constant value is NULL, so is every result
+	bool is_null = false;
+	uint8_t byte[BLOOM_PROBES] = {0};
+	uint8_t mask[BLOOM_PROBES] = {0};
+
+	unique_ptr<FunctionData> Copy() const override {
+		auto copy = make_uniq<BloomMayContainBindData>();
+		copy->has_probe = has_probe;
+		copy->is_null = is_null;
+		memcpy(copy->byte, byte, sizeof(byte));
+		memcpy(copy->mask, mask, sizeof(mask));
+		return std::move(copy);
+	}
+
+	bool Equals(const FunctionData &other_p) const override {
+		auto &other = other_p.Cast<BloomMayContainBindData>();
+		return has_probe == other.has_probe && is_null == other.is_null && memcmp(byte, other.byte, sizeof(byte)) == 0 &&
+		       memcmp(mask, other.mask, sizeof(mask)) == 0;
+	}
+};
+
+static unique_ptr<FunctionData> BloomMayContainBind(ClientContext &context, ScalarFunction &bound_function,
+                                                    vector<unique_ptr<Expression>> &arguments) {
+	auto bind_data = make_uniq<BloomMayContainBindData>();
+	if (arguments[1]->IsFoldable()) {
+		auto value = ExpressionExecutor::EvaluateScalar(context, *arguments[1]);
+		bind_data->has_probe = true;
+		if (value.IsNull()) {
+			bind_data->is_null = true;
+		} else {
+			auto &blob = StringValue::Get(value);
+			BloomProbe probe(string_t(blob.data(), UnsafeNumericCast<uint32_t>(blob.size())));
+			memcpy(bind_data->byte, probe.byte, sizeof(probe.byte));
+			memcpy(bind_data->mask, probe.mask, sizeof(probe.mask));
+		}
+	}
+	return std::move(bind_data);
+}
+
+static void BloomMayContainFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	auto &func_expr = state.expr.Cast<BoundFunctionExpression>();
+	auto &info = func_expr.bind_info->Cast<BloomMayContainBindData>();
+	if (!info.has_probe) {
+		BinaryExecutor::ExecuteWithNulls<string_t, string_t, bool>(
+		    args.data[0], args.data[1], result, args.size(),
+		    [&](string_t bloom, string_t value, ValidityMask &mask, idx_t row) {
+			    if (bloom.GetSize() != BLOOM_SIZE) {
+				    mask.SetInvalid(row);
+				    return false;
+			    }
+			    return BloomProbe(value).MayBeIn(const_data_ptr_cast(bloom.GetData()));
+		    });
+		return;
+	}
+	if (info.is_null) {
+		result.SetVectorType(VectorType::CONSTANT_VECTOR);
+		ConstantVector::SetNull(result, true);
+		return;
+	}
+	UnaryExecutor::ExecuteWithNulls<string_t, bool>(
+	    args.data[0], result, args.size(), [&](string_t bloom, ValidityMask &mask, idx_t row) {
+		    if (bloom.GetSize() != BLOOM_SIZE) {
+			    mask.SetInvalid(row);
+			    return false;
+		    }
+		    auto bits = const_data_ptr_cast(bloom.GetData());
+		    return (bits[info.byte[0]] & info.mask[0]) && (bits[info.byte[1]] & info.mask[1]) &&
+		           (bits[info.byte[2]] & info.mask[2]);
+	    });
+}
+
+void RegisterLogsBloomFunctions(DatabaseInstance &db) {
+	AggregateFunction logs_bloom_agg(
+	    "logs_bloom_agg", {AddressType(), LogicalType::LIST(Bytes32Type())}, LogicalType::BLOB,
+	    AggregateFunction::StateSize<LogsBloomState>,
+	    AggregateFunction::StateInitialize<LogsBloomState, LogsBloomOperation>, LogsBloomUpdate,
+	    AggregateFunction::StateCombine<LogsBloomState, LogsBloomOperation>,
+	    AggregateFunction::StateFinalize<LogsBloomState, string_t, LogsBloomOperation>, LogsBloomSimpleUpdate);
+	ExtensionUtil::RegisterFunction(db, logs_bloom_agg);
+
+	ExtensionUtil::RegisterFunction(db, ScalarFunction("bloom_may_contain", {LogicalType::BLOB, LogicalType::BLOB},
+	                                                   LogicalType::BOOLEAN, BloomMayContainFunction,
+	                                                   BloomMayContainBind));
+}
+
+} // namespace duckdb
@@ -2,9 +2,12 @@
 #include "duckdb/common/exception.hpp"
 #include "duckdb/function/scalar_function.hpp"
 #include "duckdb/function/table_function.hpp"
+#include "duckdb/storage/statistics/node_statistics.hpp"
 #include "duckdb/main/extension_util.hpp"
 #include "duckdb/common/types/string_type.hpp"
+#include "create2_manifest.hpp"
 #include "keccak.hpp"
+#include "fixed_bytes_utils.hpp"
 #include <cstring>
 #include <thread>
 #include <atomic>
@@ -43,53 +46,57 @@ static void ValidateAndCopyBlob(const string_t &blob, uint8_t *output, idx_t exp
 	memcpy(output, blob.GetData(), expected_size);
 }
 
-static void Create2PredictFunction(DataChunk &args, ExpressionState &state, Vector &result) {
-	UnifiedVectorFormat deployer_fmt, salt_fmt, init_hash_fmt;
-	args.data[0].ToUnifiedFormat(args.size(), deployer_fmt);
-	args.data[1].ToUnifiedFormat(args.size(), salt_fmt);
-	args.data[2].ToUnifiedFormat(args.size(), init_hash_fmt);
-
-	auto deployer_data = UnifiedVectorFormat::GetData<string_t>(deployer_fmt);
-	auto salt_data = UnifiedVectorFormat::GetData<string_t>(salt_fmt);
-	auto init_hash_data = UnifiedVectorFormat::GetData<string_t>(init_hash_fmt);
-	auto result_data = FlatVector::GetData<string_t>(result);
-
-	for (idx_t i = 0; i < args.size(); i++) {
-		auto deployer_idx = deployer_fmt.sel->get_index(i);
-		auto salt_idx = salt_fmt.sel->get_index(i);
-		auto init_hash_idx = init_hash_fmt.sel->get_index(i);
-
-		if (!deployer_fmt.validity.RowIsValid(deployer_idx) || !salt_fmt.validity.RowIsValid(salt_idx) ||
-		    !init_hash_fmt.validity.RowIsValid(init_hash_idx)) {
-			FlatVector::SetNull(result, i, true);
-			continue;
-		}
-
-		if (deployer_data[deployer_idx].GetSize() != 20 || salt_data[salt_idx].GetSize() != 32 ||
-		    init_hash_data[init_hash_idx].GetSize() != 32) {
-			FlatVector::SetNull(result, i, true);
-			continue;
+// Salt column readers for the two create2_predict overloads, false when the salt is not 32 bytes
+struct Bytes32Salt {
+	using TYPE = string_t;
+	static inline bool Read(const string_t &salt, uint8_t output[32]) {
+		if (salt.GetSize() != 32) {
+			return false;
 		}
+		memcpy(output, salt.GetData(), 32);
+		return true;
+	}
+};
 
-		uint8_t address[20];
-		Keccak::Create2(reinterpret_cast<const uint8_t *>(deployer_data[deployer_idx].GetData()),
-		                reinterpret_cast<const uint8_t *>(salt_data[salt_idx].GetData()),
-		                reinterpret_cast<const uint8_t *>(init_hash_data[init_hash_idx].GetData()), address);
-
-		result_data[i] = StringVector::AddStringOrBlob(result, reinterpret_cast<const char *>(address), 20);
+struct NumericSalt {
+	using TYPE = int64_t;
+	static inline bool Read(int64_t salt, uint8_t output[32]) {
+		SaltToBytes32(salt, output);
+		return true;
 	}
-}
+};
 
-static void Create2PredictWithNumericSalt(DataChunk &args, ExpressionState &state, Vector &result) {
+// Deployer and init_hash are nearly always constants with only the salt varying. The mining context is rebuilt
+// only when their row index changes, so a constant pair is absorbed once per chunk and every salt costs a single
+// permutation, the same as in create2_mine. Under QUACKECCAK_KECCAK_X2 consecutive rows of one context are paired.
+template <class SALT>
+static void Create2PredictExecute(DataChunk &args, Vector &result) {
 	UnifiedVectorFormat deployer_fmt, salt_fmt, init_hash_fmt;
 	args.data[0].ToUnifiedFormat(args.size(), deployer_fmt);
 	args.data[1].ToUnifiedFormat(args.size(), salt_fmt);
 	args.data[2].ToUnifiedFormat(args.size(), init_hash_fmt);
 
 	auto deployer_data = UnifiedVectorFormat::GetData<string_t>(deployer_fmt);
-	auto salt_data = UnifiedVectorFormat::GetData<int64_t>(salt_fmt);
+	auto salt_data = UnifiedVectorFormat::GetData<typename SALT::TYPE>(salt_fmt);
 	auto init_hash_data = UnifiedVectorFormat::GetData<string_t>(init_hash_fmt);
 	auto result_data = FlatVector::GetData<string_t>(result);
+	FixedWidthResultWriter<20> writer(result, args.size());
+
+	Keccak::Create2MiningContext ctx;
+	idx_t ctx_deployer_idx = DConstants::INVALID_INDEX;
+	idx_t ctx_init_hash_idx = DConstants::INVALID_INDEX;
+#ifdef QUACKECCAK_KECCAK_X2
+	// A row waiting for the next one under the same context, the two then share a two-lane permutation
+	idx_t pending_row = DConstants::INVALID_INDEX;
+	uint8_t pending_salt[32];
+	auto flush_pending = [&]() {
+		if (pending_row != DConstants::INVALID_INDEX) {
+			ctx.compute(pending_salt, writer.Slot(pending_row));
+			result_data[pending_row] = writer.Get(pending_row);
+			pending_row = DConstants::INVALID_INDEX;
+		}
+	};
+#endif
 
 	for (idx_t i = 0; i < args.size(); i++) {
 		auto deployer_idx = deployer_fmt.sel->get_index(i);
@@ -108,32 +115,96 @@ static void Create2PredictWithNumericSalt(DataChunk &args, ExpressionState &stat
 		}
 
 		uint8_t salt_bytes[32];
-		SaltToBytes32(salt_data[salt_idx], salt_bytes);
+		if (!SALT::Read(salt_data[salt_idx], salt_bytes)) {
+			FlatVector::SetNull(result, i, true);
+			continue;
+		}
 
-		uint8_t address[20];
-		Keccak::Create2(reinterpret_cast<const uint8_t *>(deployer_data[deployer_idx].GetData()), salt_bytes,
-		                reinterpret_cast<const uint8_t *>(init_hash_data[init_hash_idx].GetData()), address);
+		if (deployer_idx != ctx_deployer_idx || init_hash_idx != ctx_init_hash_idx) {
+#ifdef QUACKECCAK_KECCAK_X2
+			flush_pending();
+#endif
+			ctx.init(const_data_ptr_cast(deployer_data[deployer_idx].GetData()),
+			         const_data_ptr_cast(init_hash_data[init_hash_idx].GetData()));
+			ctx_deployer_idx = deployer_idx;
+			ctx_init_hash_idx = init_hash_idx;
+		}
 
-		result_data[i] = StringVector::AddStringOrBlob(result, reinterpret_cast<const char *>(address), 20);
+#ifdef QUACKECCAK_KECCAK_X2
+		if (pending_row == DConstants::INVALID_INDEX) {
+			memcpy(pending_salt, salt_bytes, 32);
+			pending_row = i;
+			continue;
+		}
+		ctx.compute2(pending_salt, salt_bytes, writer.Slot(pending_row), writer.Slot(i));
+		result_data[pending_row] = writer.Get(pending_row);
+		result_data[i] = writer.Get(i);
+		pending_row = DConstants::INVALID_INDEX;
+#else
+		ctx.compute(salt_bytes, writer.Slot(i));
+		result_data[i] = writer.Get(i);
+#endif
 	}
+#ifdef QUACKECCAK_KECCAK_X2
+	flush_pending();
+#endif
 }
 
-struct Create2MineData : public TableFunctionData {
+static void Create2PredictFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	Create2PredictExecute<Bytes32Salt>(args, result);
+}
+
+static void Create2PredictWithNumericSalt(DataChunk &args, ExpressionState &state, Vector &result) {
+	Create2PredictExecute<NumericSalt>(args, result);
+}
+
+// One (deployer, init_hash) pair to mine, with its context absorbed once at bind
+struct Create2MineCandidate {
 	uint8_t deployer[20];
 	uint8_t init_hash[32];
+	Keccak::Create2MiningContext ctx;
+};
+
+struct Create2MineData : public TableFunctionData {
+	// Every combination of the given deployers and init hashes
+	vector<Create2MineCandidate> candidates;
 	uint64_t salt_start;
 	uint64_t salt_count;
 	uint8_t mask[20] = {0};
 	uint8_t target[20] = {0};
 	uint64_t max_results = 100;
 	bool has_pattern = false;
+	// Set when deployer or init_hash was given as a LIST, hits then also report their init_hash
+	bool emit_init_hash = false;
+	// This process mines global salt chunks shard_index, shard_index + shard_count, ... of the range
+	uint64_t shard_index = 0;
+	uint64_t shard_count = 1;
+	// Where to write the shard manifest, none when empty
+	string manifest_path;
+};
+
+struct Create2MineHit {
+	uint64_t salt;
+	uint32_t candidate;
+	std::array<uint8_t, 20> address;
+
+	bool operator<(const Create2MineHit &other) const {
+		return salt != other.salt ? salt < other.salt : candidate < other.candidate;
+	}
 };
 
+static constexpr uint64_t CREATE2_MINE_CHUNK_SIZE = 16384;
+
 struct Create2MineGlobalState : public GlobalTableFunctionState {
-	std::atomic<uint64_t> global_salt_counter {0};
+	// Work items are (salt chunk, candidate) pairs, candidates varying fastest so that low salts of every
+	// candidate are tried first
+	std::atomic<uint64_t> global_work_counter {0};
+	uint64_t total_work = 0;
 	std::atomic<uint64_t> global_results_found {0};
-	std::vector<std::pair<uint64_t, std::array<uint8_t, 20>>> result_buffer;
-	std::vector<std::vector<std::pair<uint64_t, std::array<uint8_t, 20>>>> thread_results;
+	std::vector<Create2MineHit> result_buffer;
+	std::vector<std::vector<Create2MineHit>> thread_results;
+	// (candidate, local chunk) of every work item that ran to the end, per thread
+	std::vector<std::vector<std::pair<uint32_t, uint64_t>>> thread_completed;
 	bool workers_finished = false;
 
 	idx_t MaxThreads() const override {
@@ -155,63 +226,137 @@ static inline bool AddressMatchesPattern(const uint8_t *addr, const uint8_t *mas
 	return true;
 }
 
-static void ProcessBatch(const Create2MineData *data, Create2MineGlobalState *gstate, uint64_t salt_start,
-                         uint64_t salt_end, std::vector<std::pair<uint64_t, std::array<uint8_t, 20>>> &results) {
+// Returns false when max_results was reached before the end of the batch
+static bool ProcessBatch(const Create2MineData *data, uint32_t candidate, Create2MineGlobalState *gstate,
+                         uint64_t salt_start, uint64_t salt_end, std::vector<Create2MineHit> &results) {
 	uint8_t salt_bytes[32];
 	uint8_t address[20];
 
-	Keccak::Create2MiningContext ctx;
-	ctx.init(data->deployer, data->init_hash);
-
-	for (uint64_t salt = salt_start; salt < salt_end; salt++) {
+	auto &ctx = data->candidates[candidate].ctx;
+	auto record = [&](uint64_t salt, const uint8_t *salt_address) {
+		if (data->has_pattern && !AddressMatchesPattern(salt_address, data->mask, data->target)) {
+			return true;
+		}
+		if (gstate->global_results_found.fetch_add(1) >= data->max_results) {
+			return false;
+		}
+		Create2MineHit hit;
+		hit.salt = salt;
+		hit.candidate = candidate;
+		memcpy(hit.address.data(), salt_address, 20);
+		results.push_back(hit);
+		return true;
+	};
+
+	uint64_t salt = salt_start;
+#ifdef QUACKECCAK_KECCAK_X2
+	uint8_t next_salt_bytes[32];
+	uint8_t next_address[20];
+	for (; salt_end - salt >= 2; salt += 2) {
+		SaltToBytes32(salt, salt_bytes);
+		SaltToBytes32(salt + 1, next_salt_bytes);
+		ctx.compute2(salt_bytes, next_salt_bytes, address, next_address);
+		if (!record(salt, address) || !record(salt + 1, next_address)) {
+			return false;
+		}
+	}
+#endif
+	for (; salt < salt_end; salt++) {
 		SaltToBytes32(salt, salt_bytes);
 		ctx.compute(salt_bytes, address);
-
-		bool should_include = !data->has_pattern || AddressMatchesPattern(address, data->mask, data->target);
-
-		if (should_include) {
-			if (gstate->global_results_found.fetch_add(1) < data->max_results) {
-				std::array<uint8_t, 20> addr_array;
-				memcpy(addr_array.data(), address, 20);
-				results.emplace_back(salt, addr_array);
-			} else {
-				return;
-			}
+		if (!record(salt, address)) {
+			return false;
 		}
 	}
+	return true;
 }
 
 static void Worker(const Create2MineData *data, Create2MineGlobalState *gstate, int thread_id) {
-	constexpr uint64_t CHUNK_SIZE = 16384;
 	auto &results = gstate->thread_results[thread_id];
+	auto &completed = gstate->thread_completed[thread_id];
+	const uint64_t candidate_count = data->candidates.size();
 
 	while (true) {
-		uint64_t start = gstate->global_salt_counter.fetch_add(CHUNK_SIZE);
-		if (start >= data->salt_start + data->salt_count || gstate->global_results_found >= data->max_results) {
+		uint64_t work = gstate->global_work_counter.fetch_add(1);
+		if (work >= gstate->total_work || gstate->global_results_found >= data->max_results) {
 			break;
 		}
 
-		uint64_t end = std::min(start + CHUNK_SIZE, data->salt_start + data->salt_count);
-		ProcessBatch(data, gstate, start, end, results);
+		const uint64_t local_chunk = work / candidate_count;
+		const auto candidate = uint32_t(work % candidate_count);
+		const uint64_t chunk = data->shard_index + local_chunk * data->shard_count;
+		uint64_t start = data->salt_start + chunk * CREATE2_MINE_CHUNK_SIZE;
+		uint64_t end = std::min(start + CREATE2_MINE_CHUNK_SIZE, data->salt_start + data->salt_count);
+		if (ProcessBatch(data, candidate, gstate, start, end, results)) {
+			completed.emplace_back(candidate, local_chunk);
+		}
 	}
 }
 
+// A deployer or init_hash argument is a single value or a non-empty LIST of them
+static vector<string> GetCandidateBlobs(const Value &input, const char *name) {
+	vector<string> blobs;
+	if (input.IsNull()) {
+		throw InvalidInputException("Deployer and init_hash cannot be NULL");
+	}
+	if (input.type().id() != LogicalTypeId::LIST) {
+		blobs.push_back(StringValue::Get(input));
+		return blobs;
+	}
+	for (auto &child : ListValue::GetChildren(input)) {
+		if (child.IsNull()) {
+			throw InvalidInputException("%s list cannot contain NULL", name);
+		}
+		blobs.push_back(StringValue::Get(child));
+	}
+	if (blobs.empty()) {
+		throw InvalidInputException("%s list cannot be empty", name);
+	}
+	return blobs;
+}
+
 static unique_ptr<FunctionData> Create2MineBind(ClientContext &context, TableFunctionBindInput &input,
                                                 vector<LogicalType> &return_types, vector<string> &names) {
 	auto data = make_uniq<Create2MineData>();
 
-	if (input.inputs[0].IsNull() || input.inputs[1].IsNull()) {
-		throw InvalidInputException("Deployer and init_hash cannot be NULL");
+	auto deployers = GetCandidateBlobs(input.inputs[0], "deployer");
+	auto init_hashes = GetCandidateBlobs(input.inputs[1], "init_hash");
+	if (deployers.size() * init_hashes.size() > NumericLimits<uint32_t>::Maximum()) {
+		throw InvalidInputException("Too many (deployer, init_hash) combinations");
 	}
-
-	auto deployer_blob = StringValue::Get(input.inputs[0]);
-	ValidateAndCopyBlob(deployer_blob, data->deployer, 20, "deployer address");
-
-	auto init_hash_blob = StringValue::Get(input.inputs[1]);
-	ValidateAndCopyBlob(init_hash_blob, data->init_hash, 32, "init_hash");
+	data->candidates.resize(deployers.size() * init_hashes.size());
+	idx_t candidate = 0;
+	for (auto &deployer : deployers) {
+		for (auto &init_hash : init_hashes) {
+			auto &c = data->candidates[candidate++];
+			ValidateAndCopyBlob(deployer, c.deployer, 20, "deployer address");
+			ValidateAndCopyBlob(init_hash, c.init_hash, 32, "init_hash");
+			c.ctx.init(c.deployer, c.init_hash);
+		}
+	}
+	data->emit_init_hash =
+	    input.inputs[0].type().id() == LogicalTypeId::LIST || input.inputs[1].type().id() == LogicalTypeId::LIST;
 
 	data->salt_start = input.inputs[2].IsNull() ? 0 : input.inputs[2].GetValue<uint64_t>();
 	data->salt_count = input.inputs[3].IsNull() ? 100 : input.inputs[3].GetValue<uint64_t>();
+	data->salt_count = std::min(data->salt_count, NumericLimits<uint64_t>::Maximum() - data->salt_start);
+
+	for (auto &entry : input.named_parameters) {
+		if (entry.second.IsNull()) {
+			throw InvalidInputException("%s cannot be NULL", entry.first);
+		}
+		if (entry.first == "shard_index") {
+			data->shard_index = entry.second.GetValue<uint64_t>();
+		} else if (entry.first == "shard_count") {
+			data->shard_count = entry.second.GetValue<uint64_t>();
+		} else if (entry.first == "manifest") {
+			data->manifest_path = StringValue::Get(entry.second);
+		}
+	}
+	if (data->shard_count == 0 || data->shard_index >= data->shard_count) {
+		throw InvalidInputException("shard_index must be below shard_count, got shard %llu of %llu", data->shard_index,
+		                            data->shard_count);
+	}
 
 	if (input.inputs.size() == 7 && !input.inputs[4].IsNull() && !input.inputs[5].IsNull()) {
 		auto mask_blob = StringValue::Get(input.inputs[4]);
@@ -228,27 +373,93 @@ static unique_ptr<FunctionData> Create2MineBind(ClientContext &context, TableFun
 		}
 
 		if (!input.inputs[6].IsNull()) {
+			if (!data->manifest_path.empty()) {
+				throw InvalidInputException(
+				    "max_results cannot be combined with manifest, a shard mines its whole range");
+			}
 			data->max_results = input.inputs[6].GetValue<uint64_t>();
 			if (data->max_results == 0) {
 				throw InvalidInputException("max_results must be greater than 0");
 			}
 		}
 	}
+	// A shard that stopped early could never be merged, so its hits are not capped
+	if (!data->manifest_path.empty()) {
+		data->max_results = NumericLimits<uint64_t>::Maximum();
+	}
 
-	return_types = {AddressType(), LogicalType::UBIGINT, AddressType()};
-	names = {"deployer", "salt", "address"};
+	if (data->emit_init_hash) {
+		return_types = {AddressType(), Bytes32Type(), LogicalType::UBIGINT, AddressType()};
+		names = {"deployer", "init_hash", "salt", "address"};
+	} else {
+		return_types = {AddressType(), LogicalType::UBIGINT, AddressType()};
+		names = {"deployer", "salt", "address"};
+	}
 
 	return std::move(data);
 }
 
-static unique_ptr<GlobalTableFunctionState> Create2MineInit(ClientContext &, TableFunctionInitInput &input) {
+// Coalesces the completed work items into per-candidate ranges of local chunks and writes the shard's manifest
+static void WriteShardManifest(ClientContext &context, const Create2MineData &data, Create2MineGlobalState &gstate) {
+	Create2ShardManifest manifest;
+	manifest.shard_index = data.shard_index;
+	manifest.shard_count = data.shard_count;
+	manifest.salt_start = data.salt_start;
+	manifest.salt_count = data.salt_count;
+	manifest.chunk_size = CREATE2_MINE_CHUNK_SIZE;
+	manifest.mask.assign(const_char_ptr_cast(data.mask), 20);
+	manifest.target.assign(const_char_ptr_cast(data.target), 20);
+	for (auto &candidate : data.candidates) {
+		string deployer(const_char_ptr_cast(candidate.deployer), 20);
+		string init_hash(const_char_ptr_cast(candidate.init_hash), 32);
+		manifest.candidates.push_back({std::move(deployer), std::move(init_hash)});
+	}
+
+	std::vector<std::pair<uint32_t, uint64_t>> completed;
+	for (auto &tc : gstate.thread_completed) {
+		completed.insert(completed.end(), tc.begin(), tc.end());
+	}
+	std::sort(completed.begin(), completed.end());
+	for (auto &item : completed) {
+		if (!manifest.done.empty() && manifest.done.back().candidate == item.first &&
+		    manifest.done.back().to == item.second) {
+			manifest.done.back().to++;
+		} else {
+			manifest.done.push_back({item.first, item.second, item.second + 1});
+		}
+	}
+
+	for (auto &hit : gstate.result_buffer) {
+		manifest.hits.push_back({hit.candidate, hit.salt, string(const_char_ptr_cast(hit.address.data()), 20)});
+	}
+	manifest.Write(context, data.manifest_path);
+}
+
+static unique_ptr<GlobalTableFunctionState> Create2MineInit(ClientContext &context, TableFunctionInitInput &input) {
 	auto gstate = make_uniq<Create2MineGlobalState>();
 	auto &data = input.bind_data->Cast<Create2MineData>();
 
-	gstate->global_salt_counter = data.salt_start;
-
-	int num_threads = std::min((int)std::thread::hardware_concurrency(), std::max(1, (int)(data.salt_count / 10000)));
+	const uint64_t candidates = data.candidates.size();
+	const uint64_t chunks =
+	    data.salt_count / CREATE2_MINE_CHUNK_SIZE + (data.salt_count % CREATE2_MINE_CHUNK_SIZE != 0 ? 1 : 0);
+	// Chunks are dealt out round-robin, so every shard gets the same share of the range within one chunk
+	const uint64_t local_chunks =
+	    chunks > data.shard_index ? (chunks - data.shard_index - 1) / data.shard_count + 1 : 0;
+	// Saturates for absurd ranges instead of wrapping, the work then simply stops early
+	const uint64_t max_chunks = NumericLimits<uint64_t>::Maximum() / candidates;
+	gstate->total_work = std::min(local_chunks, max_chunks) * candidates;
+
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+	// Only the wasm_threads build of DuckDB-WASM can start threads, the others mine on the calling one
+	const uint64_t hardware_threads = 1;
+#else
+	const uint64_t hardware_threads = std::max(1u, std::thread::hardware_concurrency());
+#endif
+	const uint64_t shard_salts = data.salt_count / data.shard_count;
+	const uint64_t wanted_threads = std::min(hardware_threads, shard_salts / 10000) * candidates;
+	int num_threads = (int)std::max<uint64_t>(1, std::min(hardware_threads, wanted_threads));
 	gstate->thread_results.resize(num_threads);
+	gstate->thread_completed.resize(num_threads);
 
 	if (num_threads == 1) {
 		Worker(&data, gstate.get(), 0);
@@ -277,6 +488,10 @@ static unique_ptr<GlobalTableFunctionState> Create2MineInit(ClientContext &, Tab
 		gstate->result_buffer.resize(data.max_results);
 	}
 
+	if (!data.manifest_path.empty()) {
+		WriteShardManifest(context, data, *gstate);
+	}
+
 	gstate->workers_finished = true;
 
 	return std::move(gstate);
@@ -289,19 +504,14 @@ Create2MineLocalInit(ExecutionContext &context, TableFunctionInitInput &input, G
 
 static double Create2MineProgress(ClientContext &context, const FunctionData *bind_data_p,
                                   const GlobalTableFunctionState *global_state) {
-	auto &data = bind_data_p->Cast<Create2MineData>();
 	auto &gstate = global_state->Cast<Create2MineGlobalState>();
 
-	if (data.salt_count == 0) {
-		return 100.0;
-	}
-
-	if (gstate.workers_finished) {
+	if (gstate.total_work == 0 || gstate.workers_finished) {
 		return 100.0;
 	}
 
-	uint64_t processed = gstate.global_salt_counter.load() - data.salt_start;
-	return std::min(100.0, (static_cast<double>(processed) * 100.0) / static_cast<double>(data.salt_count));
+	uint64_t processed = std::min(gstate.global_work_counter.load(), gstate.total_work);
+	return (static_cast<double>(processed) * 100.0) / static_cast<double>(gstate.total_work);
 }
 
 static void Create2MineFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
@@ -314,19 +524,25 @@ static void Create2MineFunction(ClientContext &context, TableFunctionInput &data
 		return;
 	}
 
+	const idx_t salt_column = data.emit_init_hash ? 2 : 1;
 	auto deployer_data = FlatVector::GetData<string_t>(output.data[0]);
-	auto salt_data = FlatVector::GetData<uint64_t>(output.data[1]);
-	auto address_data = FlatVector::GetData<string_t>(output.data[2]);
+	auto salt_data = FlatVector::GetData<uint64_t>(output.data[salt_column]);
+	auto address_data = FlatVector::GetData<string_t>(output.data[salt_column + 1]);
 
 	idx_t result_idx = 0;
 	while (result_idx < STANDARD_VECTOR_SIZE && lstate.current_salt < gstate.result_buffer.size()) {
-		auto &[salt, addr] = gstate.result_buffer[lstate.current_salt];
+		auto &hit = gstate.result_buffer[lstate.current_salt];
+		auto &candidate = data.candidates[hit.candidate];
 
 		deployer_data[result_idx] =
-		    StringVector::AddStringOrBlob(output.data[0], reinterpret_cast<const char *>(data.deployer), 20);
-		salt_data[result_idx] = salt;
-		address_data[result_idx] =
-		    StringVector::AddStringOrBlob(output.data[2], reinterpret_cast<const char *>(addr.data()), 20);
+		    StringVector::AddStringOrBlob(output.data[0], reinterpret_cast<const char *>(candidate.deployer), 20);
+		if (data.emit_init_hash) {
+			FlatVector::GetData<string_t>(output.data[1])[result_idx] =
+			    StringVector::AddStringOrBlob(output.data[1], reinterpret_cast<const char *>(candidate.init_hash), 32);
+		}
+		salt_data[result_idx] = hit.salt;
+		address_data[result_idx] = StringVector::AddStringOrBlob(
+		    output.data[salt_column + 1], reinterpret_cast<const char *>(hit.address.data()), 20);
 		result_idx++;
 		lstate.current_salt++;
 	}
@@ -338,6 +554,127 @@ static void Create2MineFunction(ClientContext &context, TableFunctionInput &data
 	output.SetCardinality(result_idx);
 }
 
+// create2_addresses streams (deployer, salt, address) for a salt range without collecting anything: every scan
+// call claims the next vector of salts and hashes them straight into the output, so memory stays constant and
+// the range is spread over all scan threads
+struct Create2AddressesData : public TableFunctionData {
+	uint8_t deployer[20];
+	uint64_t salt_start;
+	uint64_t salt_count;
+	Keccak::Create2MiningContext ctx;
+};
+
+struct Create2AddressesGlobalState : public GlobalTableFunctionState {
+	explicit Create2AddressesGlobalState(idx_t max_threads) : max_threads(max_threads) {
+	}
+
+	std::atomic<uint64_t> next_offset {0};
+	idx_t max_threads;
+
+	idx_t MaxThreads() const override {
+		return max_threads;
+	}
+};
+
+static unique_ptr<FunctionData> Create2AddressesBind(ClientContext &context, TableFunctionBindInput &input,
+                                                     vector<LogicalType> &return_types, vector<string> &names) {
+	auto data = make_uniq<Create2AddressesData>();
+
+	if (input.inputs[0].IsNull() || input.inputs[1].IsNull()) {
+		throw InvalidInputException("Deployer and init_hash cannot be NULL");
+	}
+
+	ValidateAndCopyBlob(StringValue::Get(input.inputs[0]), data->deployer, 20, "deployer address");
+	uint8_t init_hash[32];
+	ValidateAndCopyBlob(StringValue::Get(input.inputs[1]), init_hash, 32, "init_hash");
+	data->ctx.init(data->deployer, init_hash);
+
+	data->salt_start = input.inputs[2].IsNull() ? 0 : input.inputs[2].GetValue<uint64_t>();
+	data->salt_count = input.inputs[3].IsNull() ? 100 : input.inputs[3].GetValue<uint64_t>();
+	// The range ends at the largest salt instead of wrapping around
+	data->salt_count = std::min(data->salt_count, NumericLimits<uint64_t>::Maximum() - data->salt_start);
+
+	return_types = {AddressType(), LogicalType::UBIGINT, AddressType()};
+	names = {"deployer", "salt", "address"};
+
+	return std::move(data);
+}
+
+static unique_ptr<GlobalTableFunctionState> Create2AddressesInit(ClientContext &, TableFunctionInitInput &input) {
+	auto &data = input.bind_data->Cast<Create2AddressesData>();
+	return make_uniq<Create2AddressesGlobalState>(data.salt_count / STANDARD_VECTOR_SIZE + 1);
+}
+
+static double Create2AddressesProgress(ClientContext &context, const FunctionData *bind_data_p,
+                                       const GlobalTableFunctionState *global_state) {
+	auto &data = bind_data_p->Cast<Create2AddressesData>();
+	auto &gstate = global_state->Cast<Create2AddressesGlobalState>();
+
+	if (data.salt_count == 0) {
+		return 100.0;
+	}
+
+	uint64_t processed = std::min(gstate.next_offset.load(), data.salt_count);
+	return (static_cast<double>(processed) * 100.0) / static_cast<double>(data.salt_count);
+}
+
+static unique_ptr<NodeStatistics> Create2AddressesCardinality(ClientContext &context, const FunctionData *bind_data_p) {
+	auto &data = bind_data_p->Cast<Create2AddressesData>();
+	return make_uniq<NodeStatistics>(data.salt_count, data.salt_count);
+}
+
+static void Create2AddressesFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.bind_data->Cast<Create2AddressesData>();
+	auto &gstate = data_p.global_state->Cast<Create2AddressesGlobalState>();
+
+	const uint64_t offset = gstate.next_offset.fetch_add(STANDARD_VECTOR_SIZE);
+	if (offset >= data.salt_count) {
+		output.SetCardinality(0);
+		return;
+	}
+	const idx_t count = std::min<uint64_t>(STANDARD_VECTOR_SIZE, data.salt_count - offset);
+
+	output.data[0].SetVectorType(VectorType::CONSTANT_VECTOR);
+	ConstantVector::GetData<string_t>(output.data[0])[0] =
+	    StringVector::AddStringOrBlob(output.data[0], const_char_ptr_cast(data.deployer), 20);
+
+	auto salt_data = FlatVector::GetData<uint64_t>(output.data[1]);
+	auto address_data = FlatVector::GetData<string_t>(output.data[2]);
+	FixedWidthResultWriter<20> writer(output.data[2], count);
+
+	uint8_t salt_bytes[32];
+	idx_t i = 0;
+#ifdef QUACKECCAK_KECCAK_X2
+	uint8_t next_salt_bytes[32];
+	for (; i + 1 < count; i += 2) {
+		const uint64_t salt = data.salt_start + offset + i;
+		SaltToBytes32(salt, salt_bytes);
+		SaltToBytes32(salt + 1, next_salt_bytes);
+		data.ctx.compute2(salt_bytes, next_salt_bytes, writer.Slot(i), writer.Slot(i + 1));
+		salt_data[i] = salt;
+		salt_data[i + 1] = salt + 1;
+		address_data[i] = writer.Get(i);
+		address_data[i + 1] = writer.Get(i + 1);
+	}
+#endif
+	for (; i < count; i++) {
+		const uint64_t salt = data.salt_start + offset + i;
+		SaltToBytes32(salt, salt_bytes);
+		data.ctx.compute(salt_bytes, writer.Slot(i));
+		salt_data[i] = salt;
+		address_data[i] = writer.Get(i);
+	}
+
+	output.SetCardinality(count);
+}
+
+// Named parameters for splitting one search over independent processes, see create2_mine_merge
+static void SetShardParameters(TableFunction &function) {
+	function.named_parameters["shard_index"] = LogicalType::UBIGINT;
+	function.named_parameters["shard_count"] = LogicalType::UBIGINT;
+	function.named_parameters["manifest"] = LogicalType::VARCHAR;
+}
+
 void RegisterCreate2Functions(DatabaseInstance &instance) {
 	ExtensionUtil::RegisterFunction(instance,
 	                                ScalarFunction("create2_predict", {AddressType(), Bytes32Type(), Bytes32Type()},
@@ -349,21 +686,38 @@ void RegisterCreate2Functions(DatabaseInstance &instance) {
 
 	TableFunctionSet create2_set("create2_mine");
 
-	TableFunction create2_mine_basic({AddressType(), Bytes32Type(), LogicalType::BIGINT, LogicalType::BIGINT},
-	                                 Create2MineFunction, Create2MineBind, Create2MineInit);
-	create2_mine_basic.init_local = Create2MineLocalInit;
-	create2_mine_basic.table_scan_progress = Create2MineProgress;
+	// Deployer and init_hash each take a single value or a LIST of candidates to sweep
+	for (auto &deployer_type : {AddressType(), LogicalType::LIST(AddressType())}) {
+		for (auto &init_hash_type : {Bytes32Type(), LogicalType::LIST(Bytes32Type())}) {
+			TableFunction create2_mine_basic({deployer_type, init_hash_type, LogicalType::BIGINT, LogicalType::BIGINT},
+			                                 Create2MineFunction, Create2MineBind, Create2MineInit);
+			create2_mine_basic.init_local = Create2MineLocalInit;
+			create2_mine_basic.table_scan_progress = Create2MineProgress;
+			SetShardParameters(create2_mine_basic);
+
+			TableFunction create2_mine_extended(
+			    {deployer_type, init_hash_type, LogicalType::BIGINT, LogicalType::BIGINT, AddressType(), AddressType(),
+			     LogicalType::BIGINT},
+			    Create2MineFunction, Create2MineBind, Create2MineInit);
+			create2_mine_extended.init_local = Create2MineLocalInit;
+			create2_mine_extended.table_scan_progress = Create2MineProgress;
+			SetShardParameters(create2_mine_extended);
+
+			create2_set.AddFunction(create2_mine_basic);
+			create2_set.AddFunction(create2_mine_extended);
+		}
+	}
 
-	TableFunction create2_mine_extended({AddressType(), Bytes32Type(), LogicalType::BIGINT, LogicalType::BIGINT,
-	                                     AddressType(), AddressType(), LogicalType::BIGINT},
-	                                    Create2MineFunction, Create2MineBind, Create2MineInit);
-	create2_mine_extended.init_local = Create2MineLocalInit;
-	create2_mine_extended.table_scan_progress = Create2MineProgress;
+	ExtensionUtil::RegisterFunction(instance, create2_set);
 
-	create2_set.AddFunction(create2_mine_basic);
-	create2_set.AddFunction(create2_mine_extended);
+	TableFunction create2_addresses("create2_addresses",
+	                                {AddressType(), Bytes32Type(), LogicalType::BIGINT, LogicalType::BIGINT},
+	                                Create2AddressesFunction, Create2AddressesBind, Create2AddressesInit);
+	create2_addresses.table_scan_progress = Create2AddressesProgress;
+	create2_addresses.cardinality = Create2AddressesCardinality;
+	ExtensionUtil::RegisterFunction(instance, create2_addresses);
 
-	ExtensionUtil::RegisterFunction(instance, create2_set);
+	RegisterCreate2MergeFunction(instance);
 }
 
 } // namespace duckdb
@@ -0,0 +1,342 @@
+#include "create2_manifest.hpp"
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/function/table_function.hpp"
+#include "duckdb/main/extension_util.hpp"
+#include "hex_codec.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+
+namespace duckdb {
+
+static LogicalType AddressType() {
+	LogicalType t(LogicalTypeId::BLOB);
+	t.SetAlias("ADDRESS");
+	return t;
+}
+
+static LogicalType Bytes32Type() {
+	LogicalType t(LogicalTypeId::BLOB);
+	t.SetAlias("BYTES32");
+	return t;
+}
+
+static constexpr const char *MANIFEST_HEADER = "quackeccak create2 shard manifest v1";
+
+uint64_t Create2ShardManifest::ChunkCount() const {
+	return salt_count / chunk_size + (salt_count % chunk_size != 0);
+}
+
+uint64_t Create2ShardManifest::LocalChunkCount(uint64_t shard) const {
+	const uint64_t chunks = ChunkCount();
+	return chunks > shard ? (chunks - shard - 1) / shard_count + 1 : 0;
+}
+
+static string HexField(const string &bytes) {
+	string out(2 + bytes.size() * 2, '0');
+	out[1] = 'x';
+	HexCodec::Encode(const_data_ptr_cast(bytes.data()), bytes.size(), &out[2]);
+	return out;
+}
+
+void Create2ShardManifest::Write(ClientContext &context, const string &path) const {
+	string out = MANIFEST_HEADER;
+	out += "\nshard\t" + std::to_string(shard_index) + "\t" + std::to_string(shard_count);
+	out += "\nrange\t" + std::to_string(salt_start) + "\t" + std::to_string(salt_count) + "\t" +
+	       std::to_string(chunk_size);
+	out += "\npattern\t" + HexField(mask) + "\t" + HexField(target);
+	for (auto &candidate : candidates) {
+		out += "\ncandidate\t" + HexField(candidate.deployer) + "\t" + HexField(candidate.init_hash);
+	}
+	for (auto &range : done) {
+		out += "\ndone\t" + std::to_string(range.candidate) + "\t" + std::to_string(range.from) + "\t" +
+		       std::to_string(range.to);
+	}
+	for (auto &hit : hits) {
+		out += "\nhit\t" + std::to_string(hit.candidate) + "\t" + std::to_string(hit.salt) + "\t" +
+		       HexField(hit.address);
+	}
+	out += "\n";
+
+	auto &fs = FileSystem::GetFileSystem(context);
+	auto handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
+	handle->Write(const_cast<char *>(out.data()), out.size());
+	handle->Sync();
+}
+
+// Parses one manifest line at a time, every malformed field fails the whole file
+class ManifestReader {
+public:
+	ManifestReader(const string &path, idx_t line) : path(path), line(line) {
+	}
+
+	[[noreturn]] void Fail() const {
+		throw InvalidInputException("create2_mine_merge: malformed manifest '%s' at line %llu", path, line + 1);
+	}
+
+	uint64_t Uint(const string &field) const {
+		if (field.empty() || !StringUtil::CharacterIsDigit(field[0])) {
+			Fail();
+		}
+		char *end;
+		errno = 0;
+		const uint64_t value = std::strtoull(field.c_str(), &end, 10);
+		if (errno != 0 || *end != '\0') {
+			Fail();
+		}
+		return value;
+	}
+
+	string Bytes(const string &field, idx_t size) const {
+		string out(size, '\0');
+		if (field.size() != 2 + size * 2 || field[0] != '0' || field[1] != 'x' ||
+		    !HexCodec::Decode(field.c_str() + 2, size, data_ptr_cast(&out[0]))) {
+			Fail();
+		}
+		return out;
+	}
+
+private:
+	const string &path;
+	idx_t line;
+};
+
+Create2ShardManifest Create2ShardManifest::Read(ClientContext &context, const string &path) {
+	auto &fs = FileSystem::GetFileSystem(context);
+	auto handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_READ);
+	const idx_t file_size = handle->GetFileSize();
+	string contents(file_size, '\0');
+	if (file_size > 0) {
+		handle->Read(const_cast<char *>(contents.data()), file_size, 0);
+	}
+
+	auto lines = StringUtil::Split(contents, '\n');
+	if (lines.empty() || lines[0] != MANIFEST_HEADER) {
+		throw InvalidInputException("create2_mine_merge: '%s' is not a create2_mine shard manifest", path);
+	}
+
+	Create2ShardManifest manifest;
+	bool has_shard = false;
+	bool has_range = false;
+	for (idx_t i = 1; i < lines.size(); i++) {
+		ManifestReader reader(path, i);
+		auto fields = StringUtil::Split(lines[i], '\t');
+		if (fields.empty()) {
+			reader.Fail();
+		}
+		auto &kind = fields[0];
+		if (kind == "shard" && fields.size() == 3) {
+			manifest.shard_index = reader.Uint(fields[1]);
+			manifest.shard_count = reader.Uint(fields[2]);
+			if (manifest.shard_count == 0 || manifest.shard_index >= manifest.shard_count) {
+				reader.Fail();
+			}
+			has_shard = true;
+		} else if (kind == "range" && fields.size() == 4) {
+			manifest.salt_start = reader.Uint(fields[1]);
+			manifest.salt_count = reader.Uint(fields[2]);
+			manifest.chunk_size = reader.Uint(fields[3]);
+			if (manifest.chunk_size == 0) {
+				reader.Fail();
+			}
+			has_range = true;
+		} else if (kind == "pattern" && fields.size() == 3) {
+			manifest.mask = reader.Bytes(fields[1], 20);
+			manifest.target = reader.Bytes(fields[2], 20);
+		} else if (kind == "candidate" && fields.size() == 3) {
+			manifest.candidates.push_back({reader.Bytes(fields[1], 20), reader.Bytes(fields[2], 32)});
+		} else if (kind == "done" && fields.size() == 4 && has_shard && has_range) {
+			DoneRange range {uint32_t(reader.Uint(fields[1])), reader.Uint(fields[2]), reader.Uint(fields[3])};
+			if (range.candidate >= manifest.candidates.size() || range.from >= range.to ||
+			    range.to > manifest.LocalChunkCount(manifest.shard_index)) {
+				reader.Fail();
+			}
+			manifest.done.push_back(range);
+		} else if (kind == "hit" && fields.size() == 4) {
+			Hit hit {uint32_t(reader.Uint(fields[1])), reader.Uint(fields[2]), reader.Bytes(fields[3], 20)};
+			if (hit.candidate >= manifest.candidates.size()) {
+				reader.Fail();
+			}
+			manifest.hits.push_back(std::move(hit));
+		} else {
+			reader.Fail();
+		}
+	}
+	if (!has_shard || !has_range || manifest.candidates.empty()) {
+		throw InvalidInputException("create2_mine_merge: manifest '%s' is incomplete", path);
+	}
+	return manifest;
+}
+
+struct Create2MergeData : public TableFunctionData {
+	vector<Create2ShardManifest::Candidate> candidates;
+	// Deduplicated hits of every shard, ordered by salt then candidate
+	vector<Create2ShardManifest::Hit> hits;
+};
+
+struct Create2MergeState : public GlobalTableFunctionState {
+	idx_t position = 0;
+};
+
+static bool SameSearch(const Create2ShardManifest &a, const Create2ShardManifest &b) {
+	if (a.shard_count != b.shard_count || a.salt_start != b.salt_start || a.salt_count != b.salt_count ||
+	    a.chunk_size != b.chunk_size || a.mask != b.mask || a.target != b.target ||
+	    a.candidates.size() != b.candidates.size()) {
+		return false;
+	}
+	for (idx_t i = 0; i < a.candidates.size(); i++) {
+		if (a.candidates[i].deployer != b.candidates[i].deployer ||
+		    a.candidates[i].init_hash != b.candidates[i].init_hash) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// Every (candidate, shard) must have completed all of the shard's chunks, possibly across several manifests of
+// the same shard (a rerun after a partial one)
+static void VerifyCoverage(const vector<Create2ShardManifest> &manifests) {
+	struct ShardRange {
+		uint32_t candidate;
+		uint64_t shard;
+		uint64_t from;
+		uint64_t to;
+	};
+	vector<ShardRange> ranges;
+	for (auto &manifest : manifests) {
+		for (auto &range : manifest.done) {
+			ranges.push_back({range.candidate, manifest.shard_index, range.from, range.to});
+		}
+	}
+	std::sort(ranges.begin(), ranges.end(), [](const ShardRange &a, const ShardRange &b) {
+		if (a.candidate != b.candidate) {
+			return a.candidate < b.candidate;
+		}
+		return a.shard != b.shard ? a.shard < b.shard : a.from < b.from;
+	});
+
+	auto &reference = manifests[0];
+	idx_t cursor = 0;
+	for (uint32_t candidate = 0; candidate < reference.candidates.size(); candidate++) {
+		for (uint64_t shard = 0; shard < reference.shard_count; shard++) {
+			const uint64_t local_chunks = reference.LocalChunkCount(shard);
+			uint64_t covered = 0;
+			for (; cursor < ranges.size() && ranges[cursor].candidate == candidate && ranges[cursor].shard == shard;
+			     cursor++) {
+				if (ranges[cursor].from <= covered) {
+					covered = MaxValue(covered, ranges[cursor].to);
+				}
+			}
+			if (covered < local_chunks) {
+				const uint64_t first = reference.salt_start + (shard + covered * reference.shard_count) *
+				                                                  reference.chunk_size;
+				auto &c = reference.candidates[candidate];
+				throw InvalidInputException(
+				    "create2_mine_merge: shard %llu of %llu did not complete the salts from %llu for deployer %s, "
+				    "init_hash %s",
+				    shard, reference.shard_count, first, HexField(c.deployer), HexField(c.init_hash));
+			}
+		}
+	}
+}
+
+static vector<string> GetManifestPaths(const Value &input) {
+	vector<string> paths;
+	if (input.IsNull()) {
+		throw InvalidInputException("create2_mine_merge: manifest paths cannot be NULL");
+	}
+	if (input.type().id() != LogicalTypeId::LIST) {
+		paths.push_back(StringValue::Get(input));
+		return paths;
+	}
+	for (auto &child : ListValue::GetChildren(input)) {
+		if (child.IsNull()) {
+			throw InvalidInputException("create2_mine_merge: manifest paths cannot be NULL");
+		}
+		paths.push_back(StringValue::Get(child));
+	}
+	if (paths.empty()) {
+		throw InvalidInputException("create2_mine_merge: no manifests given");
+	}
+	return paths;
+}
+
+static unique_ptr<FunctionData> Create2MergeBind(ClientContext &context, TableFunctionBindInput &input,
+                                                 vector<LogicalType> &return_types, vector<string> &names) {
+	auto paths = GetManifestPaths(input.inputs[0]);
+	vector<Create2ShardManifest> manifests;
+	for (auto &path : paths) {
+		manifests.push_back(Create2ShardManifest::Read(context, path));
+		if (!SameSearch(manifests[0], manifests.back())) {
+			throw InvalidInputException("create2_mine_merge: '%s' was mined with different parameters than '%s'",
+			                            path, paths[0]);
+		}
+	}
+	VerifyCoverage(manifests);
+
+	auto data = make_uniq<Create2MergeData>();
+	data->candidates = manifests[0].candidates;
+	for (auto &manifest : manifests) {
+		for (auto &hit : manifest.hits) {
+			data->hits.push_back(hit);
+		}
+	}
+	std::sort(data->hits.begin(), data->hits.end(),
+	          [](const Create2ShardManifest::Hit &a, const Create2ShardManifest::Hit &b) {
+		          return a.salt != b.salt ? a.salt < b.salt : a.candidate < b.candidate;
+	          });
+	idx_t kept = 0;
+	for (idx_t i = 0; i < data->hits.size(); i++) {
+		auto &hit = data->hits[i];
+		if (kept > 0 && data->hits[kept - 1].salt == hit.salt && data->hits[kept - 1].candidate == hit.candidate) {
+			if (data->hits[kept - 1].address != hit.address) {
+				throw InvalidInputException("create2_mine_merge: shards disagree on the address of salt %llu",
+				                            hit.salt);
+			}
+			continue;
+		}
+		data->hits[kept++] = std::move(hit);
+	}
+	data->hits.resize(kept);
+
+	return_types = {AddressType(), Bytes32Type(), LogicalType::UBIGINT, AddressType()};
+	names = {"deployer", "init_hash", "salt", "address"};
+	return std::move(data);
+}
+
+static unique_ptr<GlobalTableFunctionState> Create2MergeInit(ClientContext &, TableFunctionInitInput &) {
+	return make_uniq<Create2MergeState>();
+}
+
+static void Create2MergeFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.bind_data->Cast<Create2MergeData>();
+	auto &state = data_p.global_state->Cast<Create2MergeState>();
+
+	auto deployer_data = FlatVector::GetData<string_t>(output.data[0]);
+	auto init_hash_data = FlatVector::GetData<string_t>(output.data[1]);
+	auto salt_data = FlatVector::GetData<uint64_t>(output.data[2]);
+	auto address_data = FlatVector::GetData<string_t>(output.data[3]);
+
+	idx_t count = 0;
+	for (; count < STANDARD_VECTOR_SIZE && state.position < data.hits.size(); count++, state.position++) {
+		auto &hit = data.hits[state.position];
+		auto &candidate = data.candidates[hit.candidate];
+		deployer_data[count] = StringVector::AddStringOrBlob(output.data[0], candidate.deployer);
+		init_hash_data[count] = StringVector::AddStringOrBlob(output.data[1], candidate.init_hash);
+		salt_data[count] = hit.salt;
+		address_data[count] = StringVector::AddStringOrBlob(output.data[3], hit.address);
+	}
+	output.SetCardinality(count);
+}
+
+void RegisterCreate2MergeFunction(DatabaseInstance &instance) {
+	TableFunctionSet merge_set("create2_mine_merge");
+	merge_set.AddFunction(
+	    TableFunction({LogicalType::VARCHAR}, Create2MergeFunction, Create2MergeBind, Create2MergeInit));
+	merge_set.AddFunction(TableFunction({LogicalType::LIST(LogicalType::VARCHAR)}, Create2MergeFunction,
+	                                    Create2MergeBind, Create2MergeInit));
+	ExtensionUtil::RegisterFunction(instance, merge_set);
+}
+
+} // namespace duckdb
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "duckdb.hpp"
+
+namespace duckdb {
+
+// What one create2_mine shard covered and found. Shards split the salt range into chunks of chunk_size salts and
+// interleave them: shard i owns global chunks i, i + shard_count, i + 2 * shard_count, ... Completed work is
+// recorded per candidate as ranges [from, to) of the shard's own (local) chunk numbering
+struct Create2ShardManifest {
+	struct Candidate {
+		string deployer;
+		string init_hash;
+	};
+
+	struct DoneRange {
+		uint32_t candidate;
+		uint64_t from;
+		uint64_t to;
+	};
+
+	struct Hit {
+		uint32_t candidate;
+		uint64_t salt;
+		string address;
+	};
+
+	uint64_t shard_index = 0;
+	uint64_t shard_count = 1;
+	uint64_t salt_start = 0;
+	uint64_t salt_count = 0;
+	uint64_t chunk_size = 0;
+	// Raw 20-byte mask and target, all zero without a pattern
+	string mask;
+	string target;
+	vector<Candidate> candidates;
+	vector<DoneRange> done;
+	vector<Hit> hits;
+
+	// Number of chunks of the whole range, and of those owned by the given shard
+	uint64_t ChunkCount() const;
+	uint64_t LocalChunkCount(uint64_t shard) const;
+
+	void Write(ClientContext &context, const string &path) const;
+	static Create2ShardManifest Read(ClientContext &context, const string &path);
+};
+
+void RegisterCreate2MergeFunction(DatabaseInstance &instance);
+
+} // namespace duckdb
@@ -32,8 +32,90 @@
 #define to_le64(X) (X)
 #endif
 
+// wasm SIMD128 registers hold two 64-bit lanes, enough for two Keccak states side by side. The scalar permutation
+// compiles to plain i64 arithmetic there, so pairing independent messages is the only data parallelism on offer.
+// QUACKECCAK_KECCAK_X2_PORTABLE builds the same two-lane code paths on plain integers so native CI can test them.
+#if defined(__wasm_simd128__)
+#include <wasm_simd128.h>
+#define QUACKECCAK_KECCAK_X2 1
+#elif defined(QUACKECCAK_KECCAK_X2_PORTABLE)
+#define QUACKECCAK_KECCAK_X2 1
+#endif
+
 namespace duckdb {
 
+#if defined(QUACKECCAK_KECCAK_X2) && defined(__wasm_simd128__)
+// A lane of two Keccak states, the first in the low half of the register
+struct KeccakLanes2 {
+	v128_t v;
+
+	static ALWAYS_INLINE KeccakLanes2 make(uint64_t first, uint64_t second) {
+		return {wasm_i64x2_make(int64_t(first), int64_t(second))};
+	}
+	static ALWAYS_INLINE KeccakLanes2 splat(uint64_t value) {
+		return {wasm_i64x2_splat(int64_t(value))};
+	}
+	ALWAYS_INLINE uint64_t first() const {
+		return uint64_t(wasm_i64x2_extract_lane(v, 0));
+	}
+	ALWAYS_INLINE uint64_t second() const {
+		return uint64_t(wasm_i64x2_extract_lane(v, 1));
+	}
+	ALWAYS_INLINE KeccakLanes2 rotl(unsigned s) const {
+		return {wasm_v128_or(wasm_i64x2_shl(v, s), wasm_u64x2_shr(v, 64 - s))};
+	}
+
+	ALWAYS_INLINE KeccakLanes2 operator^(KeccakLanes2 other) const {
+		return {wasm_v128_xor(v, other.v)};
+	}
+	ALWAYS_INLINE KeccakLanes2 operator^(uint64_t constant) const {
+		return {wasm_v128_xor(v, wasm_i64x2_splat(int64_t(constant)))};
+	}
+	// ~a & b is matched to v128.andnot
+	ALWAYS_INLINE KeccakLanes2 operator&(KeccakLanes2 other) const {
+		return {wasm_v128_and(v, other.v)};
+	}
+	ALWAYS_INLINE KeccakLanes2 operator~() const {
+		return {wasm_v128_not(v)};
+	}
+};
+#elif defined(QUACKECCAK_KECCAK_X2)
+// The same interface on two plain 64-bit lanes
+struct KeccakLanes2 {
+	uint64_t lo;
+	uint64_t hi;
+
+	static ALWAYS_INLINE KeccakLanes2 make(uint64_t first, uint64_t second) {
+		return {first, second};
+	}
+	static ALWAYS_INLINE KeccakLanes2 splat(uint64_t value) {
+		return {value, value};
+	}
+	ALWAYS_INLINE uint64_t first() const {
+		return lo;
+	}
+	ALWAYS_INLINE uint64_t second() const {
+		return hi;
+	}
+	ALWAYS_INLINE KeccakLanes2 rotl(unsigned s) const {
+		return {(lo << s) | (lo >> (64 - s)), (hi << s) | (hi >> (64 - s))};
+	}
+
+	ALWAYS_INLINE KeccakLanes2 operator^(KeccakLanes2 other) const {
+		return {lo ^ other.lo, hi ^ other.hi};
+	}
+	ALWAYS_INLINE KeccakLanes2 operator^(uint64_t constant) const {
+		return {lo ^ constant, hi ^ constant};
+	}
+	ALWAYS_INLINE KeccakLanes2 operator&(KeccakLanes2 other) const {
+		return {lo & other.lo, hi & other.hi};
+	}
+	ALWAYS_INLINE KeccakLanes2 operator~() const {
+		return {~lo, ~hi};
+	}
+};
+#endif
+
 class Keccak {
 private:
 	static ALWAYS_INLINE uint64_t load_le(const uint8_t *__restrict__ data) {
@@ -46,6 +128,20 @@ private:
 		return (x << s) | (x >> (64 - s));
 	}
 
+#ifdef QUACKECCAK_KECCAK_X2
+	static ALWAYS_INLINE KeccakLanes2 rol(KeccakLanes2 x, unsigned s) {
+		return x.rotl(s);
+	}
+
+	// The first four lanes of both states, which hold both digests
+	static ALWAYS_INLINE void split_digests2(const KeccakLanes2 state[4], uint64_t a[4], uint64_t b[4]) {
+		for (size_t i = 0; i < 4; i++) {
+			a[i] = state[i].first();
+			b[i] = state[i].second();
+		}
+	}
+#endif
+
 	static constexpr uint64_t round_constants[24] = {
 	    0x0000000000000001, 0x0000000000008082, 0x800000000000808a, 0x8000000080008000, 0x000000000000808b,
 	    0x0000000080000001, 0x8000000080008081, 0x8000000000008009, 0x000000000000008a, 0x0000000000000088,
@@ -53,19 +149,22 @@ private:
 	    0x8000000000008003, 0x8000000000008002, 0x8000000000000080, 0x000000000000800a, 0x800000008000000a,
 	    0x8000000080008081, 0x8000000000008080, 0x0000000080000001, 0x8000000080008008};
 
-	static ALWAYS_INLINE void keccakf1600(uint64_t state[25]) {
-		uint64_t Aba, Abe, Abi, Abo, Abu;
-		uint64_t Aga, Age, Agi, Ago, Agu;
-		uint64_t Aka, Ake, Aki, Ako, Aku;
-		uint64_t Ama, Ame, Ami, Amo, Amu;
-		uint64_t Asa, Ase, Asi, Aso, Asu;
-		uint64_t Eba, Ebe, Ebi, Ebo, Ebu;
-		uint64_t Ega, Ege, Egi, Ego, Egu;
-		uint64_t Eka, Eke, Eki, Eko, Eku;
-		uint64_t Ema, Eme, Emi, Emo, Emu;
-		uint64_t Esa, Ese, Esi, Eso, Esu;
-		uint64_t Ba, Be, Bi, Bo, Bu;
-		uint64_t Da, De, Di, Do, Du;
+	// The permutation over any lane type with 64-bit ^, &, ~ and rol, so one body serves the scalar state and the
+	// two-states-at-once SIMD state
+	template <class LANE>
+	static ALWAYS_INLINE void permute(LANE state[25]) {
+		LANE Aba, Abe, Abi, Abo, Abu;
+		LANE Aga, Age, Agi, Ago, Agu;
+		LANE Aka, Ake, Aki, Ako, Aku;
+		LANE Ama, Ame, Ami, Amo, Amu;
+		LANE Asa, Ase, Asi, Aso, Asu;
+		LANE Eba, Ebe, Ebi, Ebo, Ebu;
+		LANE Ega, Ege, Egi, Ego, Egu;
+		LANE Eka, Eke, Eki, Eko, Eku;
+		LANE Ema, Eme, Emi, Emo, Emu;
+		LANE Esa, Ese, Esi, Eso, Esu;
+		LANE Ba, Be, Bi, Bo, Bu;
+		LANE Da, De, Di, Do, Du;
 
 		Aba = state[0];
 		Abe = state[1];
@@ -256,6 +355,10 @@ private:
 		state[24] = Asu;
 	}
 
+	static ALWAYS_INLINE void keccakf1600(uint64_t state[25]) {
+		permute(state);
+	}
+
 public:
 	static constexpr size_t HASH_SIZE = 32;
 	static constexpr unsigned int RATE = 1088; // (1600 - 512) for Keccak-256
@@ -304,6 +407,117 @@ public:
 		compute(RATE, CAPACITY, input, len, ETHEREUM_DELIMITER, output, 32);
 	}
 
+	// Keccak-256 of exactly N bytes, for the short fixed-size messages that dominate (addresses, words, pairs of
+	// words). The message fits one block, so absorption unrolls into N / 8 word loads and the padding bits sit at
+	// compile-time positions instead of going through compute's loops
+	template <size_t N>
+	static ALWAYS_INLINE void Hash256Fixed(const uint8_t *__restrict__ input, uint8_t output[32]) noexcept {
+		static_assert(N < RATE / 8, "Hash256Fixed only covers single-block messages");
+		constexpr size_t WORDS = N / 8;
+		constexpr size_t TAIL = N % 8;
+
+		alignas(64) uint64_t state[25] = {0};
+		for (size_t i = 0; i < WORDS; ++i) {
+			state[i] = load_le(input + i * 8);
+		}
+		uint64_t last_word = 0;
+		if constexpr (TAIL > 0) {
+			uint8_t tail[8] = {0};
+			QQ_MEMCPY(tail, input + WORDS * 8, TAIL);
+			last_word = load_le(tail);
+		}
+		state[WORDS] = last_word | (uint64_t(ETHEREUM_DELIMITER) << (TAIL * 8));
+		state[RATE / 64 - 1] ^= 0x8000000000000000ULL;
+		keccakf1600(state);
+		QQ_MEMCPY(output, state, 32);
+	}
+
+#ifdef QUACKECCAK_KECCAK_X2
+	// Hash256Fixed of two messages with a single two-lane permutation
+	template <size_t N>
+	static ALWAYS_INLINE void Hash256FixedX2(const uint8_t *__restrict__ input_a, const uint8_t *__restrict__ input_b,
+	                                         uint8_t output_a[32], uint8_t output_b[32]) noexcept {
+		static_assert(N < RATE / 8, "Hash256FixedX2 only covers single-block messages");
+		constexpr size_t WORDS = N / 8;
+		constexpr size_t TAIL = N % 8;
+
+		KeccakLanes2 state[25];
+		for (size_t i = 0; i < 25; ++i) {
+			state[i] = KeccakLanes2::splat(0);
+		}
+		for (size_t i = 0; i < WORDS; ++i) {
+			state[i] = KeccakLanes2::make(load_le(input_a + i * 8), load_le(input_b + i * 8));
+		}
+		uint64_t last_a = 0;
+		uint64_t last_b = 0;
+		if constexpr (TAIL > 0) {
+			uint8_t tail[16] = {0};
+			QQ_MEMCPY(tail, input_a + WORDS * 8, TAIL);
+			QQ_MEMCPY(tail + 8, input_b + WORDS * 8, TAIL);
+			last_a = load_le(tail);
+			last_b = load_le(tail + 8);
+		}
+		const uint64_t delimiter = uint64_t(ETHEREUM_DELIMITER) << (TAIL * 8);
+		state[WORDS] = KeccakLanes2::make(last_a | delimiter, last_b | delimiter);
+		state[RATE / 64 - 1] = state[RATE / 64 - 1] ^ 0x8000000000000000ULL;
+		permute(state);
+
+		uint64_t digest_a[4], digest_b[4];
+		split_digests2(state, digest_a, digest_b);
+		QQ_MEMCPY(output_a, digest_a, 32);
+		QQ_MEMCPY(output_b, digest_b, 32);
+	}
+#endif
+
+	// Incremental Keccak-256 over a message that arrives in pieces, so callers never have to materialise it
+	class Sponge {
+	private:
+		static constexpr size_t RATE_BYTES = RATE / 8;
+		alignas(64) uint64_t state[25] = {0};
+		uint8_t buffer[RATE_BYTES];
+		size_t buffered = 0;
+
+		ALWAYS_INLINE void absorb_block(const uint8_t *__restrict__ block) noexcept {
+			for (size_t i = 0; i < RATE_BYTES / 8; ++i) {
+				state[i] ^= load_le(block + i * 8);
+			}
+			keccakf1600(state);
+		}
+
+	public:
+		ALWAYS_INLINE void absorb(const uint8_t *data, size_t len) noexcept {
+			if (buffered > 0) {
+				size_t take = RATE_BYTES - buffered < len ? RATE_BYTES - buffered : len;
+				QQ_MEMCPY(buffer + buffered, data, take);
+				buffered += take;
+				data += take;
+				len -= take;
+				if (buffered < RATE_BYTES) {
+					return;
+				}
+				absorb_block(buffer);
+				buffered = 0;
+			}
+			while (len >= RATE_BYTES) {
+				absorb_block(data);
+				data += RATE_BYTES;
+				len -= RATE_BYTES;
+			}
+			if (len > 0) {
+				QQ_MEMCPY(buffer, data, len);
+				buffered = len;
+			}
+		}
+
+		void finalize(uint8_t output[32]) noexcept {
+			std::memset(buffer + buffered, 0, RATE_BYTES - buffered);
+			buffer[buffered] ^= ETHEREUM_DELIMITER;
+			buffer[RATE_BYTES - 1] ^= 0x80;
+			absorb_block(buffer);
+			QQ_MEMCPY(output, state, 32);
+		}
+	};
+
 	static void Create2(const uint8_t deployer[20], const uint8_t salt[32], const uint8_t init_hash[32],
 	                    uint8_t address[20]) noexcept {
 		static thread_local Create2MiningContext ctx;
@@ -311,27 +525,23 @@ public:
 		ctx.compute(salt, address);
 	}
 
+	// keccak256(0xff ++ deployer ++ salt ++ init_hash) is 85 bytes, a single block. Everything but the salt (bytes
+	// 21..52, lanes 2..6) is absorbed into base_state once, so each salt only fills five lanes and permutes
 	class Create2MiningContext {
 	private:
 		alignas(64) uint64_t base_state[25] = {0};
 
 	public:
 		ALWAYS_INLINE void init(const uint8_t *__restrict__ deployer, const uint8_t *__restrict__ init_hash) noexcept {
-			uint8_t buffer[53];
+			uint8_t buffer[RATE / 8] = {0};
 			buffer[0] = 0xff;
 			QQ_MEMCPY(buffer + 1, deployer, 20);
-			QQ_MEMCPY(buffer + 21, init_hash, 32);
-
-			base_state[0] = load_le(buffer);
-			base_state[1] = load_le(buffer + 8);
-			base_state[2] = load_le(buffer + 16) & 0xFFFFFFFFFFFFFF00ULL;
-			base_state[2] |= 0x00000000000000FFULL;
-			base_state[3] = 0;
-			base_state[4] = 0;
-			base_state[5] = load_le(buffer + 24);
-			base_state[6] = load_le(buffer + 32);
-			base_state[7] = load_le(buffer + 40);
-			base_state[8] = load_le(buffer + 48) & 0xFFFFFFFFFF;
+			QQ_MEMCPY(buffer + 53, init_hash, 32);
+			buffer[85] = ETHEREUM_DELIMITER;
+			buffer[RATE / 8 - 1] |= 0x80;
+			for (size_t i = 0; i < RATE / 64; i++) {
+				base_state[i] = load_le(buffer + i * 8);
+			}
 		}
 
 		[[gnu::always_inline, gnu::hot]]
@@ -339,21 +549,41 @@ public:
 			alignas(64) uint64_t state[25];
 			QQ_MEMCPY(state, base_state, sizeof(base_state));
 
-			state[2] |= (uint64_t)salt[0] << 8 | (uint64_t)salt[1] << 16 | (uint64_t)salt[2] << 24 |
-			            (uint64_t)salt[3] << 32 | (uint64_t)salt[4] << 40 | (uint64_t)salt[5] << 48 |
-			            (uint64_t)salt[6] << 56;
-			state[3] = load_le(salt + 7);
-			state[4] = load_le(salt + 15);
-			state[5] = base_state[5] | ((uint64_t)salt[23] << 56);
-			state[6] = load_le(salt + 24);
-
-			state[10] = (state[8] >> 40) | ((uint64_t)salt[28] << 0) | ((uint64_t)salt[29] << 8) |
-			            ((uint64_t)salt[30] << 16) | ((uint64_t)salt[31] << 24) | (0x01ULL << 32);
-			state[16] = 0x8000000000000000ULL;
+			// Salt bytes 0..2 end lane 2, bytes 27..31 start lane 6
+			state[2] |= load_le(salt) << 40;
+			state[3] = load_le(salt + 3);
+			state[4] = load_le(salt + 11);
+			state[5] = load_le(salt + 19);
+			state[6] |= load_le(salt + 24) >> 24;
 
 			keccakf1600(state);
 			QQ_MEMCPY(output, reinterpret_cast<const uint8_t *>(state) + 12, 20);
 		}
+
+#ifdef QUACKECCAK_KECCAK_X2
+		// compute for two salts with a single two-lane permutation
+		ALWAYS_INLINE void compute2(const uint8_t *__restrict__ salt_a, const uint8_t *__restrict__ salt_b,
+		                            uint8_t *__restrict__ output_a, uint8_t *__restrict__ output_b) const noexcept {
+			KeccakLanes2 state[25];
+			for (size_t i = 0; i < 25; i++) {
+				state[i] = KeccakLanes2::splat(base_state[i]);
+			}
+
+			state[2] =
+			    KeccakLanes2::make(base_state[2] | load_le(salt_a) << 40, base_state[2] | load_le(salt_b) << 40);
+			state[3] = KeccakLanes2::make(load_le(salt_a + 3), load_le(salt_b + 3));
+			state[4] = KeccakLanes2::make(load_le(salt_a + 11), load_le(salt_b + 11));
+			state[5] = KeccakLanes2::make(load_le(salt_a + 19), load_le(salt_b + 19));
+			state[6] = KeccakLanes2::make(base_state[6] | load_le(salt_a + 24) >> 24,
+			                              base_state[6] | load_le(salt_b + 24) >> 24);
+
+			permute(state);
+			uint64_t digest_a[4], digest_b[4];
+			split_digests2(state, digest_a, digest_b);
+			QQ_MEMCPY(output_a, reinterpret_cast<const uint8_t *>(digest_a) + 12, 20);
+			QQ_MEMCPY(output_b, reinterpret_cast<const uint8_t *>(digest_b) + 12, 20);
+		}
+#endif
 	};
 };
 
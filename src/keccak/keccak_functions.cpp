@@ -3,8 +3,10 @@
 #include "duckdb/common/exception.hpp"
 #include "duckdb/function/scalar_function.hpp"
 #include "duckdb/main/extension_util.hpp"
+#include "duckdb/execution/expression_executor_state.hpp"
 #include "../types/bytes32.hpp"
 #include "../types/address.hpp"
+#include "fixed_bytes_utils.hpp"
 #include <vector>
 #include <cstring>
 
@@ -16,84 +18,168 @@ static LogicalType Bytes32Type() {
 	return t;
 }
 
-// Fast hex conversion
-static inline int HexVal(unsigned char c) {
-	if (c >= '0' && c <= '9') {
-		return c - '0';
+// Marks NULL rows in the per-row message sizes
+static constexpr idx_t NULL_MESSAGE = DConstants::INVALID_INDEX;
+
+// Concatenates the arguments of a row into buffer, which must hold the row's size
+static inline void GatherRow(const vector<UnifiedVectorFormat> &formats, idx_t row, uint8_t *buffer) {
+	size_t offset = 0;
+	for (auto &fmt : formats) {
+		auto idx = fmt.sel->get_index(row);
+		auto &input = UnifiedVectorFormat::GetData<string_t>(fmt)[idx];
+		memcpy(buffer + offset, input.GetData(), input.GetSize());
+		offset += input.GetSize();
 	}
-	c |= 0x20;
-	if (c >= 'a' && c <= 'f') {
-		return 10 + (c - 'a');
+}
+
+// A single argument is hashed in place
+static inline const uint8_t *RowData(const UnifiedVectorFormat &fmt, idx_t row) {
+	return const_data_ptr_cast(UnifiedVectorFormat::GetData<string_t>(fmt)[fmt.sel->get_index(row)].GetData());
+}
+
+// Hashes every row of a chunk whose messages are all N bytes long
+template <size_t N>
+static void HashUniformRows(const vector<UnifiedVectorFormat> &formats, const vector<idx_t> &sizes, Vector &result) {
+	auto result_data = FlatVector::GetData<string_t>(result);
+	FixedWidthResultWriter<32> writer(result, sizes.size());
+	uint8_t buffers[2][N];
+#ifdef QUACKECCAK_KECCAK_X2
+	// Rows wait in pairs for the two-lane permutation
+	idx_t pending_row = NULL_MESSAGE;
+	const uint8_t *pending_message = nullptr;
+#endif
+
+	for (idx_t row = 0; row < sizes.size(); row++) {
+		if (sizes[row] == NULL_MESSAGE) {
+			FlatVector::SetNull(result, row, true);
+			continue;
+		}
+#ifdef QUACKECCAK_KECCAK_X2
+		const uint8_t *message = formats.size() == 1 ? RowData(formats[0], row) : nullptr;
+		if (!message) {
+			// The pending row may still be using the other buffer
+			auto buffer = buffers[pending_row == NULL_MESSAGE ? 0 : 1];
+			GatherRow(formats, row, buffer);
+			message = buffer;
+		}
+		if (pending_row == NULL_MESSAGE) {
+			pending_row = row;
+			pending_message = message;
+			continue;
+		}
+		Keccak::Hash256FixedX2<N>(pending_message, message, writer.Slot(pending_row), writer.Slot(row));
+		result_data[pending_row] = writer.Get(pending_row);
+		result_data[row] = writer.Get(row);
+		pending_row = NULL_MESSAGE;
+#else
+		const uint8_t *message = buffers[0];
+		if (formats.size() == 1) {
+			message = RowData(formats[0], row);
+		} else {
+			GatherRow(formats, row, buffers[0]);
+		}
+		Keccak::Hash256Fixed<N>(message, writer.Slot(row));
+		result_data[row] = writer.Get(row);
+#endif
 	}
-	return -1;
+
+#ifdef QUACKECCAK_KECCAK_X2
+	if (pending_row != NULL_MESSAGE) {
+		Keccak::Hash256Fixed<N>(pending_message, writer.Slot(pending_row));
+		result_data[pending_row] = writer.Get(pending_row);
+	}
+#endif
 }
 
-// Unified function for BLOB types (handles ADDRESS, BYTES32, BLOB)
-static void Keccak256UnifiedFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+// Hashes every row of a chunk with messages of any size
+static void HashRows(const vector<UnifiedVectorFormat> &formats, const vector<idx_t> &sizes, Vector &result) {
 	auto result_data = FlatVector::GetData<string_t>(result);
+	FixedWidthResultWriter<32> writer(result, sizes.size());
 
 	// Stack buffer for typical concatenations
 	uint8_t stack_buffer[1024];
 	std::vector<uint8_t> heap_buffer;
 
-	for (idx_t row = 0; row < args.size(); row++) {
-		size_t total_size = 0;
-		uint8_t *buffer_ptr = stack_buffer;
-		bool has_null = false;
-
-		// Calculate total size first
-		for (idx_t col = 0; col < args.ColumnCount(); col++) {
-			UnifiedVectorFormat fmt;
-			args.data[col].ToUnifiedFormat(args.size(), fmt);
-			auto idx = fmt.sel->get_index(row);
-
-			if (!fmt.validity.RowIsValid(idx)) {
-				has_null = true;
-				break;
-			}
-
-			auto data = UnifiedVectorFormat::GetData<string_t>(fmt);
-			total_size += data[idx].GetSize();
-		}
-
-		if (has_null) {
+	for (idx_t row = 0; row < sizes.size(); row++) {
+		if (sizes[row] == NULL_MESSAGE) {
 			FlatVector::SetNull(result, row, true);
 			continue;
 		}
 
-		// Use heap buffer if needed
-		if (total_size > sizeof(stack_buffer)) {
-			heap_buffer.resize(total_size);
-			buffer_ptr = heap_buffer.data();
+		const uint8_t *message;
+		if (formats.size() == 1) {
+			message = RowData(formats[0], row);
+		} else {
+			uint8_t *buffer_ptr = stack_buffer;
+			if (sizes[row] > sizeof(stack_buffer)) {
+				heap_buffer.resize(sizes[row]);
+				buffer_ptr = heap_buffer.data();
+			}
+			GatherRow(formats, row, buffer_ptr);
+			message = buffer_ptr;
 		}
 
-		// Copy all data
-		size_t offset = 0;
-		for (idx_t col = 0; col < args.ColumnCount(); col++) {
-			UnifiedVectorFormat fmt;
-			args.data[col].ToUnifiedFormat(args.size(), fmt);
-			auto idx = fmt.sel->get_index(row);
-			auto data = UnifiedVectorFormat::GetData<string_t>(fmt);
-			string_t input = data[idx];
+		Keccak::Hash256(message, sizes[row], writer.Slot(row));
+		result_data[row] = writer.Get(row);
+	}
+}
 
-			memcpy(buffer_ptr + offset, input.GetData(), input.GetSize());
-			offset += input.GetSize();
+// Unified kernel for BLOB types (handles ADDRESS, BYTES32, BLOB). Rows are sized first; when every row of the
+// chunk has the same common size (an address, a word, a storage slot or Merkle pair of words, an address packed
+// with two words) the whole chunk runs through the fully unrolled fixed-size hash
+static void HashBlobChunk(DataChunk &args, Vector &result) {
+	vector<UnifiedVectorFormat> formats(args.ColumnCount());
+	for (idx_t col = 0; col < args.ColumnCount(); col++) {
+		args.data[col].ToUnifiedFormat(args.size(), formats[col]);
+	}
+
+	vector<idx_t> sizes(args.size());
+	idx_t uniform_size = NULL_MESSAGE;
+	bool uniform = true;
+	for (idx_t row = 0; row < args.size(); row++) {
+		idx_t total_size = 0;
+		for (auto &fmt : formats) {
+			auto idx = fmt.sel->get_index(row);
+			if (!fmt.validity.RowIsValid(idx)) {
+				total_size = NULL_MESSAGE;
+				break;
+			}
+			total_size += UnifiedVectorFormat::GetData<string_t>(fmt)[idx].GetSize();
 		}
+		sizes[row] = total_size;
+		if (total_size != NULL_MESSAGE) {
+			uniform = uniform && (uniform_size == NULL_MESSAGE || uniform_size == total_size);
+			uniform_size = total_size;
+		}
+	}
 
-		// Hash and store result
-		uint8_t hash[32];
-		Keccak::Hash256(buffer_ptr, total_size, hash);
-		result_data[row] = StringVector::AddStringOrBlob(result, reinterpret_cast<const char *>(hash), 32);
+	switch (uniform ? uniform_size : NULL_MESSAGE) {
+	case 20:
+		HashUniformRows<20>(formats, sizes, result);
+		break;
+	case 32:
+		HashUniformRows<32>(formats, sizes, result);
+		break;
+	case 64:
+		HashUniformRows<64>(formats, sizes, result);
+		break;
+	case 84:
+		HashUniformRows<84>(formats, sizes, result);
+		break;
+	default:
+		HashRows(formats, sizes, result);
+		break;
 	}
 }
 
-// VARCHAR wrapper with hex detection
-static void Keccak256VarcharFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+// VARCHAR kernel with hex detection
+static void HashVarcharChunk(DataChunk &args, Vector &result) {
 	UnifiedVectorFormat fmt;
 	args.data[0].ToUnifiedFormat(args.size(), fmt);
 
 	auto input_data = UnifiedVectorFormat::GetData<string_t>(fmt);
 	auto result_data = FlatVector::GetData<string_t>(result);
+	FixedWidthResultWriter<32> writer(result, args.size());
 
 	uint8_t hex_buffer[512]; // Stack buffer for hex parsing
 
@@ -109,7 +195,7 @@ static void Keccak256VarcharFunction(DataChunk &args, ExpressionState &state, Ve
 		const char *data = input.GetData();
 		size_t len = input.GetSize();
 
-		uint8_t hash[32];
+		auto hash = writer.Slot(i);
 
 		// Check for hex prefix
 		if (len >= 2 && data[0] == '0' && data[1] == 'x') {
@@ -125,24 +211,105 @@ static void Keccak256VarcharFunction(DataChunk &args, ExpressionState &state, Ve
 				throw InvalidInputException("Hex string too long");
 			}
 
-			// Parse hex
-			for (size_t j = 0; j < byte_count; j++) {
-				int hi = HexVal(static_cast<unsigned char>(data[j * 2]));
-				int lo = HexVal(static_cast<unsigned char>(data[j * 2 + 1]));
-				if (hi < 0 || lo < 0) {
-					throw InvalidInputException("Invalid hex character");
-				}
-				hex_buffer[j] = static_cast<uint8_t>((hi << 4) | lo);
+			if (!HexCodec::Decode(data, byte_count, hex_buffer)) {
+				throw InvalidInputException("Invalid hex character");
 			}
 
-			Keccak::Hash256(hex_buffer, byte_count, hash);
+			// Hex literals are mostly addresses and words
+			switch (byte_count) {
+			case 20:
+				Keccak::Hash256Fixed<20>(hex_buffer, hash);
+				break;
+			case 32:
+				Keccak::Hash256Fixed<32>(hex_buffer, hash);
+				break;
+			default:
+				Keccak::Hash256(hex_buffer, byte_count, hash);
+				break;
+			}
 		} else {
 			// Hash raw string bytes
 			Keccak::Hash256(reinterpret_cast<const uint8_t *>(data), len, hash);
 		}
 
-		result_data[i] = StringVector::AddStringOrBlob(result, reinterpret_cast<const char *>(hash), 32);
+		result_data[i] = writer.Get(i);
+	}
+}
+
+// The hashed dictionary of the last dictionary vector seen by one keccak256 expression. Dictionaries with an id
+// (Parquet column chunks) span many vectors and are hashed once for all of them. A dictionary that failed to hash
+// is remembered so its later vectors go straight to the rows
+struct KeccakDictionaryState : public FunctionLocalState {
+	string dictionary_id;
+	unique_ptr<Vector> hashed;
+	string failed_dictionary_id;
+};
+
+static unique_ptr<FunctionLocalState> KeccakInitLocalState(ExpressionState &state, const BoundFunctionExpression &expr,
+                                                           FunctionData *bind_data) {
+	return make_uniq<KeccakDictionaryState>();
+}
+
+// Hashes the dictionary of a single dictionary argument instead of its rows, false when that would not save work
+template <void (*KERNEL)(DataChunk &, Vector &)>
+static bool HashDictionary(DataChunk &args, ExpressionState &state, Vector &result) {
+	auto &input = args.data[0];
+	if (args.ColumnCount() != 1 || input.GetVectorType() != VectorType::DICTIONARY_VECTOR) {
+		return false;
+	}
+	auto dictionary_size = DictionaryVector::DictionarySize(input);
+	if (!dictionary_size.IsValid()) {
+		return false;
+	}
+	auto &local = ExecuteFunctionState::GetFunctionState(state)->Cast<KeccakDictionaryState>();
+	auto &dictionary_id = DictionaryVector::DictionaryId(input);
+	if (!dictionary_id.empty() && dictionary_id == local.failed_dictionary_id) {
+		return false;
+	}
+	if (dictionary_id.empty() || dictionary_id != local.dictionary_id || !local.hashed) {
+		// A dictionary that is not shared with other vectors only pays off when it is smaller than the chunk
+		if (dictionary_id.empty() && dictionary_size.GetIndex() >= args.size()) {
+			return false;
+		}
+		DataChunk dictionary;
+		dictionary.InitializeEmpty(args.GetTypes());
+		dictionary.SetCapacity(dictionary_size.GetIndex());
+		dictionary.data[0].Reference(DictionaryVector::Child(input));
+		dictionary.SetCardinality(dictionary_size.GetIndex());
+		local.dictionary_id.clear();
+		local.hashed = make_uniq<Vector>(result.GetType(), dictionary_size.GetIndex());
+		try {
+			KERNEL(dictionary, *local.hashed);
+		} catch (InvalidInputException &) {
+			// An entry no row refers to may be invalid hex; the rows decide whether that is an error
+			local.hashed.reset();
+			local.failed_dictionary_id = dictionary_id;
+			return false;
+		}
+		local.dictionary_id = dictionary_id;
+	}
+	result.Dictionary(*local.hashed, dictionary_size.GetIndex(), DictionaryVector::SelVector(input), args.size());
+	return true;
+}
+
+// Repeated values are hashed once: constant arguments as a single row, dictionary arguments per dictionary entry
+template <void (*KERNEL)(DataChunk &, Vector &)>
+static void Keccak256Function(DataChunk &args, ExpressionState &state, Vector &result) {
+	if (args.AllConstant()) {
+		DataChunk single;
+		single.InitializeEmpty(args.GetTypes());
+		for (idx_t col = 0; col < args.ColumnCount(); col++) {
+			single.data[col].Reference(args.data[col]);
+		}
+		single.SetCardinality(1);
+		KERNEL(single, result);
+		result.SetVectorType(VectorType::CONSTANT_VECTOR);
+		return;
+	}
+	if (HashDictionary<KERNEL>(args, state, result)) {
+		return;
 	}
+	KERNEL(args, result);
 }
 
 void RegisterKeccakFunctions(DatabaseInstance &instance) {
@@ -150,18 +317,23 @@ void RegisterKeccakFunctions(DatabaseInstance &instance) {
 
 	// VARCHAR with hex detection
 	keccak_set.AddFunction(
-	    ScalarFunction("keccak256", {LogicalType::VARCHAR}, Bytes32Type(), Keccak256VarcharFunction));
+	    ScalarFunction("keccak256", {LogicalType::VARCHAR}, Bytes32Type(), Keccak256Function<HashVarcharChunk>));
 
 	// Single BLOB (handles ADDRESS, BYTES32, and raw BLOB via implicit casting)
-	keccak_set.AddFunction(ScalarFunction("keccak256", {LogicalType::BLOB}, Bytes32Type(), Keccak256UnifiedFunction));
+	keccak_set.AddFunction(
+	    ScalarFunction("keccak256", {LogicalType::BLOB}, Bytes32Type(), Keccak256Function<HashBlobChunk>));
 
 	// Two BLOBs
-	keccak_set.AddFunction(
-	    ScalarFunction("keccak256", {LogicalType::BLOB, LogicalType::BLOB}, Bytes32Type(), Keccak256UnifiedFunction));
+	keccak_set.AddFunction(ScalarFunction("keccak256", {LogicalType::BLOB, LogicalType::BLOB}, Bytes32Type(),
+	                                      Keccak256Function<HashBlobChunk>));
 
 	// Three BLOBs (common for Merkle trees)
 	keccak_set.AddFunction(ScalarFunction("keccak256", {LogicalType::BLOB, LogicalType::BLOB, LogicalType::BLOB},
-	                                      Bytes32Type(), Keccak256UnifiedFunction));
+	                                      Bytes32Type(), Keccak256Function<HashBlobChunk>));
+
+	for (auto &function : keccak_set.functions) {
+		function.init_local_state = KeccakInitLocalState;
+	}
 
 	ExtensionUtil::RegisterFunction(instance, keccak_set);
 }
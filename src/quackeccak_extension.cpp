@@ -4,6 +4,16 @@
 #include "types/evm_types.hpp"
 #include "keccak/keccak_functions.hpp"
 #include "abi/selectors.hpp"
+#include "abi/abi_decode.hpp"
+#include "abi/abi_encode.hpp"
+#include "abi/log_decoder.hpp"
+#include "abi/selector_lookup.hpp"
+#include "rlp/rlp_functions.hpp"
+#include "rlp/tx_hash.hpp"
+#include "rlp/mpt_root.hpp"
+#include "bloom/logs_bloom.hpp"
+#include "secp256k1/ecrecover.hpp"
+#include "rpc/read_evm_rpc.hpp"
 #include "create2.hpp"
 #include "duckdb.hpp"
 
@@ -14,6 +24,16 @@ static void LoadInternal(DatabaseInstance &instance) {
 	RegisterKeccakFunctions(instance);
 	RegisterCreate2Functions(instance);
 	RegisterABISelectorFunctions(instance);
+	RegisterABIDecodeFunctions(instance);
+	RegisterABIEncodeFunctions(instance);
+	RegisterLogDecoderFunctions(instance);
+	RegisterSelectorLookupFunctions(instance);
+	RegisterRlpFunctions(instance);
+	RegisterTxHashFunctions(instance);
+	RegisterMptRootFunctions(instance);
+	RegisterLogsBloomFunctions(instance);
+	RegisterEcrecoverFunctions(instance);
+	RegisterReadEvmRpcFunction(instance);
 }
 
 void QuackeccakExtension::Load(DuckDB &db) {
@@ -0,0 +1,268 @@
+#include "mpt_root.hpp"
+#include "rlp.hpp"
+#include "duckdb/main/extension_util.hpp"
+#include "duckdb/common/types/blob.hpp"
+#include "duckdb/function/aggregate_function.hpp"
+#include "keccak.hpp"
+#include <algorithm>
+
+namespace duckdb {
+
+static LogicalType Bytes32Type() {
+	LogicalType t(LogicalTypeId::BLOB);
+	t.SetAlias("BYTES32");
+	return t;
+}
+
+// Key and value bytes live in the aggregate's arena, the state only tracks where
+struct MptEntry {
+	const uint8_t *key;
+	const uint8_t *value;
+	uint32_t key_size;
+	uint32_t value_size;
+};
+
+struct MptRootState {
+	vector<MptEntry> *entries;
+};
+
+static inline const uint8_t *CopyToArena(ArenaAllocator &allocator, const uint8_t *data, idx_t size) {
+	if (size == 0) {
+		return nullptr;
+	}
+	auto copy = allocator.Allocate(size);
+	memcpy(copy, data, size);
+	return copy;
+}
+
+// Builds the Merkle-Patricia trie of a sorted key set in one pass over a single growing buffer. Each node is
+// encoded in place after its children, and children of 32 bytes or more are replaced by their hash right away,
+// so the buffer never holds more than one path of the trie
+class MptBuilder {
+public:
+	explicit MptBuilder(const vector<MptEntry> &entries) : entries(entries) {
+	}
+
+	void Root(uint8_t out[32]) {
+		if (entries.empty()) {
+			// keccak256(rlp(""))
+			const uint8_t empty = Rlp::STRING_OFFSET;
+			Keccak::Hash256(&empty, 1, out);
+			return;
+		}
+		buffer.clear();
+		EncodeNode(0, entries.size(), 0);
+		Keccak::Hash256(buffer.data(), buffer.size(), out);
+	}
+
+private:
+	static constexpr idx_t MAX_HEADER = 1 + sizeof(uint64_t);
+	static constexpr idx_t BRANCH_WIDTH = 16;
+
+	const vector<MptEntry> &entries;
+	vector<uint8_t> buffer;
+
+	static inline idx_t Nibbles(const MptEntry &entry) {
+		return idx_t(entry.key_size) * 2;
+	}
+
+	static inline uint8_t Nibble(const MptEntry &entry, idx_t i) {
+		const uint8_t byte = entry.key[i / 2];
+		return (i & 1) ? byte & 0x0F : byte >> 4;
+	}
+
+	void AppendHeader(uint8_t offset, idx_t payload) {
+		uint8_t header[MAX_HEADER];
+		buffer.insert(buffer.end(), header, Rlp::WriteHeader(header, offset, payload));
+	}
+
+	void AppendString(const uint8_t *data, idx_t size) {
+		if (size == 1 && data[0] < Rlp::STRING_OFFSET) {
+			buffer.push_back(data[0]);
+			return;
+		}
+		AppendHeader(Rlp::STRING_OFFSET, size);
+		buffer.insert(buffer.end(), data, data + size);
+	}
+
+	// Hex-prefix encoding of the key nibbles [from, to): a flag nibble for leaf/extension and odd length, then the
+	// nibbles packed in pairs. Its first byte is always below 0x80, so a one-byte path needs no string header
+	void AppendPath(const MptEntry &entry, idx_t from, idx_t to, bool leaf) {
+		const idx_t count = to - from;
+		const idx_t size = count / 2 + 1;
+		if (size > 1) {
+			AppendHeader(Rlp::STRING_OFFSET, size);
+		}
+		const uint8_t flag = uint8_t((leaf ? 2 : 0) + (count & 1));
+		idx_t i = from;
+		if (count & 1) {
+			buffer.push_back(uint8_t(flag << 4 | Nibble(entry, i++)));
+		} else {
+			buffer.push_back(uint8_t(flag << 4));
+		}
+		for (; i < to; i += 2) {
+			buffer.push_back(uint8_t(Nibble(entry, i) << 4 | Nibble(entry, i + 1)));
+		}
+	}
+
+	// A child is embedded in its parent when its encoding is shorter than 32 bytes, otherwise referenced by hash
+	void AppendReference(idx_t lo, idx_t hi, idx_t depth) {
+		const idx_t mark = buffer.size();
+		EncodeNode(lo, hi, depth);
+		const idx_t size = buffer.size() - mark;
+		if (size < 32) {
+			return;
+		}
+		uint8_t hash[32];
+		Keccak::Hash256(buffer.data() + mark, size, hash);
+		buffer.resize(mark);
+		AppendString(hash, 32);
+	}
+
+	// Encodes the node holding entries [lo, hi), whose keys share their first `depth` nibbles
+	void EncodeNode(idx_t lo, idx_t hi, idx_t depth) {
+		// The list header is only known once the payload is written, leave room for the longest one
+		const idx_t start = buffer.size();
+		buffer.resize(start + MAX_HEADER);
+		const idx_t payload_start = buffer.size();
+
+		auto &first = entries[lo];
+		if (hi - lo == 1) {
+			AppendPath(first, depth, Nibbles(first), true);
+			AppendString(first.value, first.value_size);
+		} else {
+			// Sorted keys share exactly the prefix the first and last one share
+			auto &last = entries[hi - 1];
+			idx_t shared = 0;
+			while (depth + shared < Nibbles(first) && depth + shared < Nibbles(last) &&
+			       Nibble(first, depth + shared) == Nibble(last, depth + shared)) {
+				shared++;
+			}
+			if (shared > 0) {
+				AppendPath(first, depth, depth + shared, false);
+				AppendReference(lo, hi, depth + shared);
+			} else {
+				// A key ending here sorts first and becomes the branch value
+				idx_t i = lo;
+				const bool has_value = Nibbles(first) == depth;
+				if (has_value) {
+					i++;
+				}
+				for (uint8_t nibble = 0; nibble < BRANCH_WIDTH; nibble++) {
+					idx_t j = i;
+					while (j < hi && Nibble(entries[j], depth) == nibble) {
+						j++;
+					}
+					if (j > i) {
+						AppendReference(i, j, depth + 1);
+					} else {
+						buffer.push_back(Rlp::STRING_OFFSET);
+					}
+					i = j;
+				}
+				if (has_value) {
+					AppendString(first.value, first.value_size);
+				} else {
+					buffer.push_back(Rlp::STRING_OFFSET);
+				}
+			}
+		}
+
+		const idx_t payload = buffer.size() - payload_start;
+		uint8_t header[MAX_HEADER];
+		const idx_t header_size = Rlp::WriteHeader(header, Rlp::LIST_OFFSET, payload) - header;
+		memmove(buffer.data() + start + header_size, buffer.data() + payload_start, payload);
+		memcpy(buffer.data() + start, header, header_size);
+		buffer.resize(start + header_size + payload);
+	}
+};
+
+// Byte order of the common prefix, which is nibble order
+static inline int CompareKeys(const MptEntry &a, const MptEntry &b) {
+	const idx_t common = MinValue(a.key_size, b.key_size);
+	return common == 0 ? 0 : memcmp(a.key, b.key, common);
+}
+
+struct MptRootOperation {
+	template <class STATE>
+	static void Initialize(STATE &state) {
+		state.entries = nullptr;
+	}
+
+	template <class A_TYPE, class B_TYPE, class STATE, class OP>
+	static void Operation(STATE &state, const A_TYPE &key, const B_TYPE &value, AggregateBinaryInput &input) {
+		if (value.GetSize() == 0) {
+			// An empty value is an absent key
+			return;
+		}
+		if (!state.entries) {
+			state.entries = new vector<MptEntry>();
+		}
+		auto &allocator = input.input.allocator;
+		MptEntry entry;
+		entry.key_size = UnsafeNumericCast<uint32_t>(key.GetSize());
+		entry.value_size = UnsafeNumericCast<uint32_t>(value.GetSize());
+		entry.key = CopyToArena(allocator, const_data_ptr_cast(key.GetData()), entry.key_size);
+		entry.value = CopyToArena(allocator, const_data_ptr_cast(value.GetData()), entry.value_size);
+		state.entries->push_back(entry);
+	}
+
+	// Partial states from other threads are appended, the trie is only built once all keys of a group are known
+	template <class STATE, class OP>
+	static void Combine(const STATE &source, STATE &target, AggregateInputData &input) {
+		if (!source.entries) {
+			return;
+		}
+		if (!target.entries) {
+			target.entries = new vector<MptEntry>();
+		}
+		target.entries->reserve(target.entries->size() + source.entries->size());
+		for (auto &entry : *source.entries) {
+			MptEntry copy = entry;
+			copy.key = CopyToArena(input.allocator, entry.key, entry.key_size);
+			copy.value = CopyToArena(input.allocator, entry.value, entry.value_size);
+			target.entries->push_back(copy);
+		}
+	}
+
+	template <class T, class STATE>
+	static void Finalize(STATE &state, T &target, AggregateFinalizeData &finalize_data) {
+		vector<MptEntry> empty;
+		auto &entries = state.entries ? *state.entries : empty;
+		std::sort(entries.begin(), entries.end(), [](const MptEntry &a, const MptEntry &b) {
+			const int cmp = CompareKeys(a, b);
+			return cmp != 0 ? cmp < 0 : a.key_size < b.key_size;
+		});
+		for (idx_t i = 1; i < entries.size(); i++) {
+			auto &key = entries[i];
+			if (key.key_size == entries[i - 1].key_size && CompareKeys(key, entries[i - 1]) == 0) {
+				auto blob = string_t(const_char_ptr_cast(key.key), key.key_size);
+				throw InvalidInputException("mpt_root: duplicate key '%s'", Blob::ToString(blob));
+			}
+		}
+
+		uint8_t root[32];
+		MptBuilder(entries).Root(root);
+		target = StringVector::AddStringOrBlob(finalize_data.result, const_char_ptr_cast(root), 32);
+	}
+
+	template <class STATE>
+	static void Destroy(STATE &state, AggregateInputData &) {
+		delete state.entries;
+		state.entries = nullptr;
+	}
+
+	static bool IgnoreNull() {
+		return true;
+	}
+};
+
+void RegisterMptRootFunctions(DatabaseInstance &db) {
+	auto mpt_root = AggregateFunction::BinaryAggregate<MptRootState, string_t, string_t, string_t, MptRootOperation>(
+	    LogicalType::BLOB, LogicalType::BLOB, Bytes32Type());
+	mpt_root.name = "mpt_root";
+	mpt_root.destructor = AggregateFunction::StateDestroy<MptRootState, MptRootOperation>;
+	ExtensionUtil::RegisterFunction(db, mpt_root);
+}
+
+} // namespace duckdb
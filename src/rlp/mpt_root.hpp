@@ -0,0 +1,9 @@
+#pragma once
+
+#include "duckdb.hpp"
+
+namespace duckdb {
+
+void RegisterMptRootFunctions(DatabaseInstance &db);
+
+} // namespace duckdb
@@ -0,0 +1,134 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include <cstring>
+
+namespace duckdb {
+
+// Recursive Length Prefix primitives. Encoders size an item first and then write it into a buffer of exactly
+// that size, so nothing here allocates
+class Rlp {
+public:
+	static constexpr uint8_t STRING_OFFSET = 0x80;
+	static constexpr uint8_t LIST_OFFSET = 0xC0;
+	// Payloads shorter than this carry their length in the prefix byte itself
+	static constexpr idx_t SHORT_PAYLOAD = 56;
+
+	// Bytes needed to write v big-endian without leading zeros
+	static inline idx_t ByteLength(uint64_t v) {
+		idx_t n = 0;
+		while (v) {
+			n++;
+			v >>= 8;
+		}
+		return n;
+	}
+
+	static inline idx_t HeaderSize(idx_t payload) {
+		return payload < SHORT_PAYLOAD ? 1 : 1 + ByteLength(payload);
+	}
+
+	static inline idx_t StringSize(const uint8_t *data, idx_t len) {
+		return (len == 1 && data[0] < STRING_OFFSET) ? 1 : HeaderSize(len) + len;
+	}
+
+	static inline idx_t UintSize(uint64_t v) {
+		return v < STRING_OFFSET ? 1 : 1 + ByteLength(v);
+	}
+
+	static inline uint8_t *WriteHeader(uint8_t *out, uint8_t offset, idx_t payload) {
+		if (payload < SHORT_PAYLOAD) {
+			*out++ = uint8_t(offset + payload);
+			return out;
+		}
+		const idx_t n = ByteLength(payload);
+		*out++ = uint8_t(offset + SHORT_PAYLOAD - 1 + n);
+		for (idx_t i = n; i > 0; i--) {
+			*out++ = uint8_t(payload >> ((i - 1) * 8));
+		}
+		return out;
+	}
+
+	static inline uint8_t *WriteString(uint8_t *out, const uint8_t *data, idx_t len) {
+		if (len == 1 && data[0] < STRING_OFFSET) {
+			*out++ = data[0];
+			return out;
+		}
+		out = WriteHeader(out, STRING_OFFSET, len);
+		memcpy(out, data, len);
+		return out + len;
+	}
+
+	// Integers are big-endian scalars with no leading zeros, zero is the empty string
+	static inline uint8_t *WriteUint(uint8_t *out, uint64_t v) {
+		if (v != 0 && v < STRING_OFFSET) {
+			*out++ = uint8_t(v);
+			return out;
+		}
+		const idx_t n = ByteLength(v);
+		*out++ = uint8_t(STRING_OFFSET + n);
+		for (idx_t i = n; i > 0; i--) {
+			*out++ = uint8_t(v >> ((i - 1) * 8));
+		}
+		return out;
+	}
+
+	// Strips the leading zeros of a big-endian integer such as a UINT256 word
+	static inline void TrimLeadingZeros(const uint8_t *&data, idx_t &len) {
+		while (len > 0 && *data == 0) {
+			data++;
+			len--;
+		}
+	}
+
+	struct Item {
+		bool is_list;
+		const uint8_t *payload;
+		idx_t payload_size;
+		// Prefix plus payload
+		idx_t size;
+	};
+
+	// Reads the item starting at data. Only canonical encodings are accepted: single bytes below 0x80 must not be
+	// wrapped, short payloads must use the short form and long-form lengths must not have leading zeros
+	static inline bool ReadItem(const uint8_t *data, idx_t size, Item &item) {
+		if (size == 0) {
+			return false;
+		}
+		const uint8_t prefix = data[0];
+		if (prefix < STRING_OFFSET) {
+			item = {false, data, 1, 1};
+			return true;
+		}
+		const bool is_list = prefix >= LIST_OFFSET;
+		const uint8_t short_prefix = prefix - (is_list ? LIST_OFFSET : STRING_OFFSET);
+		idx_t header = 1;
+		idx_t payload;
+		if (short_prefix < SHORT_PAYLOAD) {
+			payload = short_prefix;
+			if (!is_list && payload == 1 && (size < 2 || data[1] < STRING_OFFSET)) {
+				return false;
+			}
+		} else {
+			const idx_t n = short_prefix - (SHORT_PAYLOAD - 1);
+			if (n > sizeof(uint64_t) || size < 1 + n || data[1] == 0) {
+				return false;
+			}
+			payload = 0;
+			for (idx_t i = 0; i < n; i++) {
+				payload = (payload << 8) | data[1 + i];
+			}
+			if (payload < SHORT_PAYLOAD) {
+				return false;
+			}
+			header += n;
+		}
+		if (payload > size - header) {
+			return false;
+		}
+		item = {is_list, data + header, payload, header + payload};
+		return true;
+	}
+};
+
+} // namespace duckdb
@@ -0,0 +1,163 @@
+#include "rlp_encoder.hpp"
+
+namespace duckdb {
+
+RlpEncodePlan BuildRlpEncodePlan(const LogicalType &type) {
+	RlpEncodePlan plan;
+	plan.physical = type.InternalType();
+	switch (type.id()) {
+	case LogicalTypeId::SQLNULL:
+	case LogicalTypeId::VARCHAR:
+		plan.kind = RlpValueKind::BYTES;
+		break;
+	case LogicalTypeId::BLOB:
+		plan.kind = type.HasAlias() && type.GetAlias() == "UINT256" ? RlpValueKind::UINT256 : RlpValueKind::BYTES;
+		break;
+	case LogicalTypeId::BOOLEAN:
+		plan.kind = RlpValueKind::BOOLEAN;
+		break;
+	case LogicalTypeId::UTINYINT:
+	case LogicalTypeId::USMALLINT:
+	case LogicalTypeId::UINTEGER:
+	case LogicalTypeId::UBIGINT:
+		plan.kind = RlpValueKind::UNSIGNED;
+		break;
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+		plan.kind = RlpValueKind::SIGNED;
+		break;
+	case LogicalTypeId::LIST:
+		plan.kind = RlpValueKind::LIST;
+		plan.children.push_back(BuildRlpEncodePlan(ListType::GetChildType(type)));
+		break;
+	case LogicalTypeId::ARRAY:
+		plan.kind = RlpValueKind::ARRAY;
+		plan.array_size = ArrayType::GetSize(type);
+		plan.children.push_back(BuildRlpEncodePlan(ArrayType::GetChildType(type)));
+		break;
+	case LogicalTypeId::STRUCT:
+		plan.kind = RlpValueKind::STRUCT;
+		for (auto &child : StructType::GetChildTypes(type)) {
+			plan.children.push_back(BuildRlpEncodePlan(child.second));
+		}
+		break;
+	default:
+		throw InvalidInputException("rlp_encode: cannot encode values of type %s", type.ToString());
+	}
+	return plan;
+}
+
+uint64_t RlpEncoder::ReadInteger(const RlpEncodePlan &plan, const UnifiedVectorFormat &fmt, idx_t idx) {
+	int64_t value;
+	switch (plan.physical) {
+	case PhysicalType::UINT8:
+		return UnifiedVectorFormat::GetData<uint8_t>(fmt)[idx];
+	case PhysicalType::UINT16:
+		return UnifiedVectorFormat::GetData<uint16_t>(fmt)[idx];
+	case PhysicalType::UINT32:
+		return UnifiedVectorFormat::GetData<uint32_t>(fmt)[idx];
+	case PhysicalType::UINT64:
+		return UnifiedVectorFormat::GetData<uint64_t>(fmt)[idx];
+	case PhysicalType::INT8:
+		value = UnifiedVectorFormat::GetData<int8_t>(fmt)[idx];
+		break;
+	case PhysicalType::INT16:
+		value = UnifiedVectorFormat::GetData<int16_t>(fmt)[idx];
+		break;
+	case PhysicalType::INT32:
+		value = UnifiedVectorFormat::GetData<int32_t>(fmt)[idx];
+		break;
+	case PhysicalType::INT64:
+		value = UnifiedVectorFormat::GetData<int64_t>(fmt)[idx];
+		break;
+	default:
+		throw InternalException("rlp_encode: unexpected integer type");
+	}
+	if (value < 0) {
+		throw InvalidInputException("rlp_encode: cannot encode negative integer %lld", value);
+	}
+	return uint64_t(value);
+}
+
+bool ReadRlpUint64(const RlpEncodePlan &plan, const UnifiedVectorFormat &fmt, idx_t idx, uint64_t &out) {
+	switch (plan.kind) {
+	case RlpValueKind::UNSIGNED:
+	case RlpValueKind::SIGNED: {
+		out = RlpEncoder::ReadInteger(plan, fmt, idx);
+		return true;
+	}
+	case RlpValueKind::UINT256: {
+		auto &value = UnifiedVectorFormat::GetData<string_t>(fmt)[idx];
+		auto ptr = const_data_ptr_cast(value.GetData());
+		idx_t len = value.GetSize();
+		Rlp::TrimLeadingZeros(ptr, len);
+		if (len > sizeof(uint64_t)) {
+			return false;
+		}
+		out = 0;
+		for (idx_t i = 0; i < len; i++) {
+			out = (out << 8) | ptr[i];
+		}
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+idx_t RlpEncoder::MeasureList(const RlpEncodePlan &plan, const RecursiveUnifiedVectorFormat &fmt, idx_t idx) {
+	const idx_t slot = list_sizes.size();
+	list_sizes.push_back(0);
+	idx_t payload = 0;
+	switch (plan.kind) {
+	case RlpValueKind::LIST: {
+		auto &entry = UnifiedVectorFormat::GetData<list_entry_t>(fmt.unified)[idx];
+		for (idx_t i = 0; i < entry.length; i++) {
+			payload += Measure(plan.children[0], fmt.children[0], entry.offset + i);
+		}
+		break;
+	}
+	case RlpValueKind::ARRAY:
+		for (idx_t i = 0; i < plan.array_size; i++) {
+			payload += Measure(plan.children[0], fmt.children[0], idx * plan.array_size + i);
+		}
+		break;
+	default:
+		for (idx_t i = 0; i < plan.children.size(); i++) {
+			payload += Measure(plan.children[i], fmt.children[i], idx);
+		}
+		break;
+	}
+	list_sizes[slot] = payload;
+	return Rlp::HeaderSize(payload) + payload;
+}
+
+idx_t RlpEncoder::Measure(const RlpEncodePlan &plan, const RecursiveUnifiedVectorFormat &fmt, idx_t row) {
+	auto idx = fmt.unified.sel->get_index(row);
+	if (!fmt.unified.validity.RowIsValid(idx)) {
+		return 1;
+	}
+	switch (plan.kind) {
+	case RlpValueKind::BYTES:
+	case RlpValueKind::UINT256: {
+		auto &value = UnifiedVectorFormat::GetData<string_t>(fmt.unified)[idx];
+		auto ptr = const_data_ptr_cast(value.GetData());
+		idx_t len = value.GetSize();
+		if (plan.kind == RlpValueKind::UINT256) {
+			Rlp::TrimLeadingZeros(ptr, len);
+		}
+		return Rlp::StringSize(ptr, len);
+	}
+	case RlpValueKind::BOOLEAN:
+		return 1;
+	case RlpValueKind::UNSIGNED:
+	case RlpValueKind::SIGNED:
+		return Rlp::UintSize(ReadInteger(plan, fmt.unified, idx));
+	default:
+		return MeasureList(plan, fmt, idx);
+	}
+}
+
+} // namespace duckdb
@@ -0,0 +1,148 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "rlp.hpp"
+#include "keccak.hpp"
+
+namespace duckdb {
+
+enum class RlpValueKind : uint8_t { BYTES, UINT256, UNSIGNED, SIGNED, BOOLEAN, LIST, ARRAY, STRUCT };
+
+// How one level of a DuckDB type maps onto RLP, built once at bind
+struct RlpEncodePlan {
+	RlpValueKind kind;
+	PhysicalType physical;
+	idx_t array_size = 0;
+	vector<RlpEncodePlan> children;
+
+	bool IsList() const {
+		return kind == RlpValueKind::LIST || kind == RlpValueKind::ARRAY || kind == RlpValueKind::STRUCT;
+	}
+};
+
+// Throws for types with no RLP representation
+RlpEncodePlan BuildRlpEncodePlan(const LogicalType &type);
+
+// Reads an integer (native or UINT256) that must fit in 64 bits, false when it does not
+bool ReadRlpUint64(const RlpEncodePlan &plan, const UnifiedVectorFormat &fmt, idx_t idx, uint64_t &out);
+
+struct RlpBufferSink {
+	uint8_t *out;
+	inline void Append(const uint8_t *data, idx_t len) {
+		memcpy(out, data, len);
+		out += len;
+	}
+};
+
+struct RlpSpongeSink {
+	Keccak::Sponge sponge;
+	inline void Append(const uint8_t *data, idx_t len) {
+		sponge.absorb(data, len);
+	}
+};
+
+// Two passes over a value: Measure sizes it and records each list's payload size in pre-order, Write then emits
+// it into a sink, consuming those sizes in the same order. NULL values encode as the empty string, or the empty
+// list for list types (a contract creation's `to`, a missing access list)
+class RlpEncoder {
+public:
+	idx_t Measure(const RlpEncodePlan &plan, const RecursiveUnifiedVectorFormat &fmt, idx_t row);
+
+	template <class SINK>
+	void Write(const RlpEncodePlan &plan, const RecursiveUnifiedVectorFormat &fmt, idx_t row, SINK &sink) {
+		auto idx = fmt.unified.sel->get_index(row);
+		if (!fmt.unified.validity.RowIsValid(idx)) {
+			const uint8_t empty = plan.IsList() ? Rlp::LIST_OFFSET : Rlp::STRING_OFFSET;
+			sink.Append(&empty, 1);
+			return;
+		}
+		switch (plan.kind) {
+		case RlpValueKind::BYTES:
+		case RlpValueKind::UINT256: {
+			auto &value = UnifiedVectorFormat::GetData<string_t>(fmt.unified)[idx];
+			auto ptr = const_data_ptr_cast(value.GetData());
+			idx_t len = value.GetSize();
+			if (plan.kind == RlpValueKind::UINT256) {
+				Rlp::TrimLeadingZeros(ptr, len);
+			}
+			WriteString(sink, ptr, len);
+			return;
+		}
+		case RlpValueKind::BOOLEAN:
+			WriteUint(sink, UnifiedVectorFormat::GetData<bool>(fmt.unified)[idx] ? 1 : 0);
+			return;
+		case RlpValueKind::UNSIGNED:
+		case RlpValueKind::SIGNED:
+			WriteUint(sink, ReadInteger(plan, fmt.unified, idx));
+			return;
+		case RlpValueKind::LIST: {
+			auto &entry = UnifiedVectorFormat::GetData<list_entry_t>(fmt.unified)[idx];
+			WriteNextListHeader(sink);
+			for (idx_t i = 0; i < entry.length; i++) {
+				Write(plan.children[0], fmt.children[0], entry.offset + i, sink);
+			}
+			return;
+		}
+		case RlpValueKind::ARRAY:
+			WriteNextListHeader(sink);
+			for (idx_t i = 0; i < plan.array_size; i++) {
+				Write(plan.children[0], fmt.children[0], idx * plan.array_size + i, sink);
+			}
+			return;
+		case RlpValueKind::STRUCT:
+			WriteNextListHeader(sink);
+			for (idx_t i = 0; i < plan.children.size(); i++) {
+				Write(plan.children[i], fmt.children[i], idx, sink);
+			}
+			return;
+		default:
+			throw InternalException("rlp_encode: unexpected value kind");
+		}
+	}
+
+	// Native integers, negative values throw
+	static uint64_t ReadInteger(const RlpEncodePlan &plan, const UnifiedVectorFormat &fmt, idx_t idx);
+
+	// Forgets the list sizes of previously measured values
+	void Reset() {
+		list_sizes.clear();
+		cursor = 0;
+	}
+
+	template <class SINK>
+	static void WriteString(SINK &sink, const uint8_t *data, idx_t len) {
+		if (len == 1 && data[0] < Rlp::STRING_OFFSET) {
+			sink.Append(data, 1);
+			return;
+		}
+		uint8_t header[1 + sizeof(uint64_t)];
+		sink.Append(header, Rlp::WriteHeader(header, Rlp::STRING_OFFSET, len) - header);
+		sink.Append(data, len);
+	}
+
+	template <class SINK>
+	static void WriteUint(SINK &sink, uint64_t v) {
+		uint8_t buffer[1 + sizeof(uint64_t)];
+		sink.Append(buffer, Rlp::WriteUint(buffer, v) - buffer);
+	}
+
+	template <class SINK>
+	static void WriteListHeader(SINK &sink, idx_t payload) {
+		uint8_t header[1 + sizeof(uint64_t)];
+		sink.Append(header, Rlp::WriteHeader(header, Rlp::LIST_OFFSET, payload) - header);
+	}
+
+private:
+	// Payload sizes of every list measured so far, in the order Write visits them
+	vector<idx_t> list_sizes;
+	idx_t cursor = 0;
+
+	idx_t MeasureList(const RlpEncodePlan &plan, const RecursiveUnifiedVectorFormat &fmt, idx_t idx);
+
+	template <class SINK>
+	void WriteNextListHeader(SINK &sink) {
+		WriteListHeader(sink, list_sizes[cursor++]);
+	}
+};
+
+} // namespace duckdb
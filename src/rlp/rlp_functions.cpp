@@ -0,0 +1,182 @@
+#include "rlp_functions.hpp"
+#include "rlp_encoder.hpp"
+#include "duckdb/main/extension_util.hpp"
+#include "duckdb/common/operator/cast_operators.hpp"
+#include "duckdb/common/vector_operations/binary_executor.hpp"
+#include "duckdb/function/scalar_function.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
+
+namespace duckdb {
+
+static LogicalType AddressType() {
+	LogicalType t(LogicalTypeId::BLOB);
+	t.SetAlias("ADDRESS");
+	return t;
+}
+
+struct RlpEncodeBindData : public FunctionData {
+	LogicalType type;
+	RlpEncodePlan plan;
+
+	unique_ptr<FunctionData> Copy() const override {
+		auto copy = make_uniq<RlpEncodeBindData>();
+		copy->type = type;
+		copy->plan = plan;
+		return std::move(copy);
+	}
+
+	bool Equals(const FunctionData &other_p) const override {
+		return type == other_p.Cast<RlpEncodeBindData>().type;
+	}
+};
+
+static unique_ptr<FunctionData> RlpEncodeBind(ClientContext &context, ScalarFunction &bound_function,
+                                              vector<unique_ptr<Expression>> &arguments) {
+	auto bind_data = make_uniq<RlpEncodeBindData>();
+	bind_data->type = arguments[0]->return_type;
+	bind_data->plan = BuildRlpEncodePlan(bind_data->type);
+	bound_function.arguments[0] = bind_data->type;
+	return std::move(bind_data);
+}
+
+static void RlpEncodeFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	auto &func_expr = state.expr.Cast<BoundFunctionExpression>();
+	auto &info = func_expr.bind_info->Cast<RlpEncodeBindData>();
+	const idx_t count = args.size();
+
+	RecursiveUnifiedVectorFormat fmt;
+	Vector::RecursiveToUnifiedFormat(args.data[0], count, fmt);
+
+	RlpEncoder encoder;
+	vector<idx_t> sizes(count);
+	for (idx_t row = 0; row < count; row++) {
+		if (fmt.unified.validity.RowIsValid(fmt.unified.sel->get_index(row))) {
+			sizes[row] = encoder.Measure(info.plan, fmt, row);
+		}
+	}
+
+	auto result_data = FlatVector::GetData<string_t>(result);
+	for (idx_t row = 0; row < count; row++) {
+		if (!fmt.unified.validity.RowIsValid(fmt.unified.sel->get_index(row))) {
+			FlatVector::SetNull(result, row, true);
+			continue;
+		}
+		result_data[row] = StringVector::EmptyString(result, sizes[row]);
+		RlpBufferSink sink {data_ptr_cast(result_data[row].GetDataWriteable())};
+		encoder.Write(info.plan, fmt, row, sink);
+		result_data[row].Finalize();
+	}
+
+	if (args.AllConstant()) {
+		result.SetVectorType(VectorType::CONSTANT_VECTOR);
+	}
+}
+
+// Top-level items of an RLP list. Nested lists come back as their own encoding so they can be decoded again
+static void RlpDecodeFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	const idx_t count = args.size();
+	UnifiedVectorFormat fmt;
+	args.data[0].ToUnifiedFormat(count, fmt);
+	auto inputs = UnifiedVectorFormat::GetData<string_t>(fmt);
+
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto list_data = FlatVector::GetData<list_entry_t>(result);
+	for (idx_t row = 0; row < count; row++) {
+		auto idx = fmt.sel->get_index(row);
+		if (!fmt.validity.RowIsValid(idx)) {
+			FlatVector::SetNull(result, row, true);
+			continue;
+		}
+		auto data = const_data_ptr_cast(inputs[idx].GetData());
+		const idx_t size = inputs[idx].GetSize();
+		Rlp::Item outer;
+		if (!Rlp::ReadItem(data, size, outer) || outer.size != size || !outer.is_list) {
+			FlatVector::SetNull(result, row, true);
+			continue;
+		}
+
+		// Validate and count the items before reserving room for them
+		idx_t items = 0;
+		bool valid = true;
+		Rlp::Item item;
+		for (idx_t pos = 0; pos < outer.payload_size; pos += item.size) {
+			if (!Rlp::ReadItem(outer.payload + pos, outer.payload_size - pos, item)) {
+				valid = false;
+				break;
+			}
+			items++;
+		}
+		if (!valid) {
+			FlatVector::SetNull(result, row, true);
+			continue;
+		}
+
+		const idx_t offset = ListVector::GetListSize(result);
+		ListVector::Reserve(result, offset + items);
+		auto &child = ListVector::GetEntry(result);
+		auto child_data = FlatVector::GetData<string_t>(child);
+		idx_t pos = 0;
+		for (idx_t i = 0; i < items; i++) {
+			Rlp::ReadItem(outer.payload + pos, outer.payload_size - pos, item);
+			auto ptr = item.is_list ? outer.payload + pos : item.payload;
+			auto len = item.is_list ? item.size : item.payload_size;
+			child_data[offset + i] = StringVector::AddStringOrBlob(child, const_char_ptr_cast(ptr), len);
+			pos += item.size;
+		}
+		list_data[row].offset = offset;
+		list_data[row].length = items;
+		ListVector::SetListSize(result, offset + items);
+	}
+
+	if (args.AllConstant()) {
+		result.SetVectorType(VectorType::CONSTANT_VECTOR);
+	}
+}
+
+// CREATE deployments land at keccak256(rlp([sender, nonce]))[12:]. The list is at most 1 + 21 + 9 bytes, so it is
+// written straight into a stack buffer
+static inline bool CreateAddress(const string_t &deployer, uint64_t nonce, uint8_t output[20]) {
+	if (deployer.GetSize() != 20) {
+		return false;
+	}
+	uint8_t buffer[1 + 21 + 9];
+	uint8_t *out = Rlp::WriteHeader(buffer, Rlp::LIST_OFFSET, 21 + Rlp::UintSize(nonce));
+	out = Rlp::WriteString(out, const_data_ptr_cast(deployer.GetData()), 20);
+	out = Rlp::WriteUint(out, nonce);
+	uint8_t hash[32];
+	Keccak::Hash256(buffer, out - buffer, hash);
+	memcpy(output, hash + 12, 20);
+	return true;
+}
+
+template <class T>
+static void CreateAddressFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	BinaryExecutor::ExecuteWithNulls<string_t, T, string_t>(
+	    args.data[0], args.data[1], result, args.size(),
+	    [&](string_t deployer, T nonce, ValidityMask &mask, idx_t row) {
+		    uint64_t value;
+		    uint8_t address[20];
+		    if (!TryCast::Operation<T, uint64_t>(nonce, value) || !CreateAddress(deployer, value, address)) {
+			    mask.SetInvalid(row);
+			    return string_t();
+		    }
+		    return StringVector::AddStringOrBlob(result, const_char_ptr_cast(address), 20);
+	    });
+}
+
+void RegisterRlpFunctions(DatabaseInstance &db) {
+	ScalarFunction rlp_encode("rlp_encode", {LogicalType::ANY}, LogicalType::BLOB, RlpEncodeFunction, RlpEncodeBind);
+	ExtensionUtil::RegisterFunction(db, rlp_encode);
+
+	ExtensionUtil::RegisterFunction(db, ScalarFunction("rlp_decode", {LogicalType::BLOB},
+	                                                   LogicalType::LIST(LogicalType::BLOB), RlpDecodeFunction));
+
+	ScalarFunctionSet create_address("create_address");
+	create_address.AddFunction(ScalarFunction({AddressType(), LogicalType::UBIGINT}, AddressType(),
+	                                          CreateAddressFunction<uint64_t>));
+	create_address.AddFunction(ScalarFunction({AddressType(), LogicalType::BIGINT}, AddressType(),
+	                                          CreateAddressFunction<int64_t>));
+	ExtensionUtil::RegisterFunction(db, create_address);
+}
+
+} // namespace duckdb
@@ -0,0 +1,9 @@
+#pragma once
+
+#include "duckdb.hpp"
+
+namespace duckdb {
+
+void RegisterRlpFunctions(DatabaseInstance &db);
+
+} // namespace duckdb
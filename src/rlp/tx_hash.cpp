@@ -0,0 +1,350 @@
+#include "tx_hash.hpp"
+#include "rlp_encoder.hpp"
+#include "duckdb/main/extension_util.hpp"
+#include "duckdb/function/scalar_function.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
+
+namespace duckdb {
+
+static LogicalType Bytes32Type() {
+	LogicalType t(LogicalTypeId::BLOB);
+	t.SetAlias("BYTES32");
+	return t;
+}
+
+enum class TxField : uint8_t {
+	TYPE,
+	CHAIN_ID,
+	NONCE,
+	GAS_PRICE,
+	MAX_PRIORITY_FEE_PER_GAS,
+	MAX_FEE_PER_GAS,
+	GAS,
+	TO,
+	VALUE,
+	INPUT,
+	ACCESS_LIST,
+	MAX_FEE_PER_BLOB_GAS,
+	BLOB_VERSIONED_HASHES,
+	Y_PARITY,
+	V,
+	R,
+	S,
+	// Not a struct field: the EIP-155 chain id and zero placeholders of a legacy signing payload
+	LEGACY_CHAIN_ID,
+	ZERO
+};
+
+static constexpr idx_t TX_STRUCT_FIELDS = idx_t(TxField::S) + 1;
+static constexpr idx_t TX_TYPES = 4;
+// nonce, gasPrice, gas, to, value, data
+static constexpr idx_t PRE_EIP155_SIGNING_ITEMS = 6;
+
+// Accepted struct field names, snake_case as in most exports and camelCase as in JSON-RPC
+static const char *const TX_FIELD_NAMES[TX_STRUCT_FIELDS][3] = {
+    {"type", nullptr, nullptr},
+    {"chain_id", "chainId", nullptr},
+    {"nonce", nullptr, nullptr},
+    {"gas_price", "gasPrice", nullptr},
+    {"max_priority_fee_per_gas", "maxPriorityFeePerGas", nullptr},
+    {"max_fee_per_gas", "maxFeePerGas", nullptr},
+    {"gas", "gas_limit", "gasLimit"},
+    {"to", "to_address", nullptr},
+    {"value", nullptr, nullptr},
+    {"input", "data", nullptr},
+    {"access_list", "accessList", nullptr},
+    {"max_fee_per_blob_gas", "maxFeePerBlobGas", nullptr},
+    {"blob_versioned_hashes", "blobVersionedHashes", nullptr},
+    {"y_parity", "yParity", nullptr},
+    {"v", nullptr, nullptr},
+    {"r", nullptr, nullptr},
+    {"s", nullptr, nullptr},
+};
+
+// Fields that are RLP integers
+static constexpr TxField TX_QUANTITY_FIELDS[] = {
+    TxField::TYPE, TxField::CHAIN_ID, TxField::NONCE, TxField::GAS_PRICE, TxField::MAX_PRIORITY_FEE_PER_GAS,
+    TxField::MAX_FEE_PER_GAS, TxField::GAS, TxField::VALUE, TxField::MAX_FEE_PER_BLOB_GAS, TxField::Y_PARITY,
+    TxField::V, TxField::R, TxField::S};
+
+// Envelope item order per transaction type (legacy, EIP-2930, EIP-1559, EIP-4844), signature excluded
+static vector<TxField> UnsignedTxFields(idx_t type) {
+	switch (type) {
+	case 0:
+		return {TxField::NONCE, TxField::GAS_PRICE, TxField::GAS, TxField::TO, TxField::VALUE, TxField::INPUT};
+	case 1:
+		return {TxField::CHAIN_ID, TxField::NONCE, TxField::GAS_PRICE, TxField::GAS,
+		        TxField::TO,       TxField::VALUE, TxField::INPUT,     TxField::ACCESS_LIST};
+	case 2:
+		return {TxField::CHAIN_ID, TxField::NONCE, TxField::MAX_PRIORITY_FEE_PER_GAS, TxField::MAX_FEE_PER_GAS,
+		        TxField::GAS,      TxField::TO,    TxField::VALUE,                    TxField::INPUT,
+		        TxField::ACCESS_LIST};
+	default:
+		return {TxField::CHAIN_ID,    TxField::NONCE, TxField::MAX_PRIORITY_FEE_PER_GAS, TxField::MAX_FEE_PER_GAS,
+		        TxField::GAS,         TxField::TO,    TxField::VALUE,                    TxField::INPUT,
+		        TxField::ACCESS_LIST, TxField::MAX_FEE_PER_BLOB_GAS, TxField::BLOB_VERSIONED_HASHES};
+	}
+}
+
+struct TxHashBindData : public FunctionData {
+	LogicalType type;
+	bool signing = false;
+	// Struct child holding each field, INVALID_INDEX when the struct lacks it
+	idx_t child_index[TX_STRUCT_FIELDS];
+	vector<RlpEncodePlan> plans;
+	// Envelope items per transaction type, empty when the struct lacks a field that type needs
+	vector<TxField> layouts[TX_TYPES];
+
+	unique_ptr<FunctionData> Copy() const override {
+		auto copy = make_uniq<TxHashBindData>();
+		copy->type = type;
+		copy->signing = signing;
+		memcpy(copy->child_index, child_index, sizeof(child_index));
+		copy->plans = plans;
+		for (idx_t i = 0; i < TX_TYPES; i++) {
+			copy->layouts[i] = layouts[i];
+		}
+		return std::move(copy);
+	}
+
+	bool Equals(const FunctionData &other_p) const override {
+		auto &other = other_p.Cast<TxHashBindData>();
+		return type == other.type && signing == other.signing;
+	}
+
+	bool HasField(TxField field) const {
+		return child_index[idx_t(field)] != DConstants::INVALID_INDEX;
+	}
+};
+
+static unique_ptr<FunctionData> TxHashBind(ClientContext &context, ScalarFunction &bound_function,
+                                           vector<unique_ptr<Expression>> &arguments, bool signing) {
+	auto &name = bound_function.name;
+	auto &type = arguments[0]->return_type;
+	if (type.id() != LogicalTypeId::STRUCT) {
+		throw InvalidInputException("%s: expected a STRUCT of transaction fields, got %s", name, type.ToString());
+	}
+
+	auto bind_data = make_uniq<TxHashBindData>();
+	bind_data->type = type;
+	bind_data->signing = signing;
+	bind_data->plans.resize(TX_STRUCT_FIELDS);
+	auto &children = StructType::GetChildTypes(type);
+	for (idx_t f = 0; f < TX_STRUCT_FIELDS; f++) {
+		bind_data->child_index[f] = DConstants::INVALID_INDEX;
+		for (idx_t c = 0; c < children.size() && bind_data->child_index[f] == DConstants::INVALID_INDEX; c++) {
+			for (auto alias : TX_FIELD_NAMES[f]) {
+				if (alias && StringUtil::CIEquals(children[c].first, alias)) {
+					bind_data->child_index[f] = c;
+					bind_data->plans[f] = BuildRlpEncodePlan(children[c].second);
+					break;
+				}
+			}
+		}
+	}
+	// Quantities are RLP integers without leading zeros, so byte strings of any width (BYTES32 signatures, raw
+	// BLOBs) are encoded as big-endian integers rather than verbatim
+	for (auto field : TX_QUANTITY_FIELDS) {
+		if (!bind_data->HasField(field)) {
+			continue;
+		}
+		auto &plan = bind_data->plans[idx_t(field)];
+		auto &child_type = children[bind_data->child_index[idx_t(field)]].second;
+		if (child_type.id() == LogicalTypeId::BLOB) {
+			plan.kind = RlpValueKind::UINT256;
+		} else if (plan.kind != RlpValueKind::UNSIGNED && plan.kind != RlpValueKind::SIGNED &&
+		           child_type.id() != LogicalTypeId::SQLNULL) {
+			throw InvalidInputException("%s: field '%s' must be an integer", name, TX_FIELD_NAMES[idx_t(field)][0]);
+		}
+	}
+
+	// Typed transactions carry the signature's parity directly, RPC nodes also report it as v
+	const auto parity = bind_data->HasField(TxField::Y_PARITY) ? TxField::Y_PARITY : TxField::V;
+	string missing;
+	for (idx_t tx_type = 0; tx_type < TX_TYPES; tx_type++) {
+		auto layout = UnsignedTxFields(tx_type);
+		if (!signing) {
+			layout.push_back(tx_type == 0 ? TxField::V : parity);
+			layout.push_back(TxField::R);
+			layout.push_back(TxField::S);
+		} else if (tx_type == 0) {
+			layout.push_back(TxField::LEGACY_CHAIN_ID);
+			layout.push_back(TxField::ZERO);
+			layout.push_back(TxField::ZERO);
+		}
+		bool complete = true;
+		for (auto field : layout) {
+			if (idx_t(field) < TX_STRUCT_FIELDS && !bind_data->HasField(field)) {
+				if (missing.empty()) {
+					missing = TX_FIELD_NAMES[idx_t(field)][0];
+				}
+				complete = false;
+				break;
+			}
+		}
+		if (complete) {
+			bind_data->layouts[tx_type] = std::move(layout);
+		}
+	}
+	bool any = false;
+	for (idx_t tx_type = 0; tx_type < TX_TYPES; tx_type++) {
+		any = any || !bind_data->layouts[tx_type].empty();
+	}
+	if (!any) {
+		throw InvalidInputException("%s: transaction struct is missing field '%s'", name, missing);
+	}
+
+	bound_function.arguments[0] = type;
+	return std::move(bind_data);
+}
+
+static unique_ptr<FunctionData> TxHashBindHash(ClientContext &context, ScalarFunction &bound_function,
+                                               vector<unique_ptr<Expression>> &arguments) {
+	return TxHashBind(context, bound_function, arguments, false);
+}
+
+static unique_ptr<FunctionData> TxHashBindSigning(ClientContext &context, ScalarFunction &bound_function,
+                                                  vector<unique_ptr<Expression>> &arguments) {
+	return TxHashBind(context, bound_function, arguments, true);
+}
+
+// Whether the struct has the field and it is not NULL for the row
+static bool TxFieldIsValid(const TxHashBindData &info, const RecursiveUnifiedVectorFormat &fmt, idx_t idx,
+                           TxField field) {
+	if (!info.HasField(field)) {
+		return false;
+	}
+	auto &child = fmt.children[info.child_index[idx_t(field)]].unified;
+	return child.validity.RowIsValid(child.sel->get_index(idx));
+}
+
+// Reads an integer field of the row's struct, false when the struct lacks it, it is NULL or it exceeds 64 bits
+static bool ReadTxUint(const TxHashBindData &info, const RecursiveUnifiedVectorFormat &fmt, idx_t idx, TxField field,
+                       uint64_t &out) {
+	if (!TxFieldIsValid(info, fmt, idx, field)) {
+		return false;
+	}
+	auto &child = fmt.children[info.child_index[idx_t(field)]].unified;
+	return ReadRlpUint64(info.plans[idx_t(field)], child, child.sel->get_index(idx), out);
+}
+
+// Fields whose NULL is a legitimate encoding: a contract creation's empty `to` and empty lists
+static bool TxFieldMayBeNull(TxField field) {
+	return field == TxField::TO || field == TxField::ACCESS_LIST || field == TxField::BLOB_VERSIONED_HASHES;
+}
+
+static void TxHashFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	auto &func_expr = state.expr.Cast<BoundFunctionExpression>();
+	auto &info = func_expr.bind_info->Cast<TxHashBindData>();
+	const idx_t count = args.size();
+
+	RecursiveUnifiedVectorFormat fmt;
+	Vector::RecursiveToUnifiedFormat(args.data[0], count, fmt);
+	auto result_data = FlatVector::GetData<string_t>(result);
+
+	RlpEncoder encoder;
+	for (idx_t row = 0; row < count; row++) {
+		auto idx = fmt.unified.sel->get_index(row);
+		if (!fmt.unified.validity.RowIsValid(idx)) {
+			FlatVector::SetNull(result, row, true);
+			continue;
+		}
+		uint64_t tx_type = 0;
+		if (info.HasField(TxField::TYPE) && !ReadTxUint(info, fmt, idx, TxField::TYPE, tx_type)) {
+			// A NULL type is a legacy transaction, an oversized one is not a transaction
+			auto &type_fmt = fmt.children[info.child_index[idx_t(TxField::TYPE)]].unified;
+			tx_type = type_fmt.validity.RowIsValid(type_fmt.sel->get_index(idx)) ? TX_TYPES : 0;
+		}
+		if (tx_type >= TX_TYPES || info.layouts[tx_type].empty()) {
+			FlatVector::SetNull(result, row, true);
+			continue;
+		}
+		auto &layout = info.layouts[tx_type];
+		idx_t items = layout.size();
+
+		// Legacy signing payloads follow EIP-155 when v says so (or, unsigned, when a chain id is given)
+		uint64_t chain_id = 0;
+		if (info.signing && tx_type == 0) {
+			uint64_t v;
+			if (ReadTxUint(info, fmt, idx, TxField::V, v)) {
+				if (v >= 35) {
+					chain_id = (v - 35) / 2;
+				} else {
+					items = PRE_EIP155_SIGNING_ITEMS;
+				}
+			} else if (!ReadTxUint(info, fmt, idx, TxField::CHAIN_ID, chain_id)) {
+				items = PRE_EIP155_SIGNING_ITEMS;
+			}
+		}
+
+		// Any other NULL field leaves the transaction incomplete, its hash would be plausible but wrong. Exports
+		// that carry both report the parity in v when y_parity is NULL.
+		auto parity = TxField::Y_PARITY;
+		bool complete = true;
+		for (idx_t i = 0; i < items && complete; i++) {
+			const auto field = layout[i];
+			if (idx_t(field) >= TX_STRUCT_FIELDS || TxFieldMayBeNull(field) || TxFieldIsValid(info, fmt, idx, field)) {
+				continue;
+			}
+			if (field == TxField::Y_PARITY && TxFieldIsValid(info, fmt, idx, TxField::V)) {
+				parity = TxField::V;
+				continue;
+			}
+			complete = false;
+		}
+		if (!complete) {
+			FlatVector::SetNull(result, row, true);
+			continue;
+		}
+
+		// Size the envelope, then stream it into the sponge
+		encoder.Reset();
+		idx_t payload = 0;
+		for (idx_t i = 0; i < items; i++) {
+			const auto field = layout[i] == TxField::Y_PARITY ? parity : layout[i];
+			if (field == TxField::LEGACY_CHAIN_ID) {
+				payload += Rlp::UintSize(chain_id);
+			} else if (field == TxField::ZERO) {
+				payload += 1;
+			} else {
+				const idx_t child = info.child_index[idx_t(field)];
+				payload += encoder.Measure(info.plans[idx_t(field)], fmt.children[child], idx);
+			}
+		}
+
+		RlpSpongeSink sink;
+		if (tx_type != 0) {
+			const uint8_t envelope_type = uint8_t(tx_type);
+			sink.Append(&envelope_type, 1);
+		}
+		RlpEncoder::WriteListHeader(sink, payload);
+		for (idx_t i = 0; i < items; i++) {
+			const auto field = layout[i] == TxField::Y_PARITY ? parity : layout[i];
+			if (field == TxField::LEGACY_CHAIN_ID) {
+				RlpEncoder::WriteUint(sink, chain_id);
+			} else if (field == TxField::ZERO) {
+				RlpEncoder::WriteUint(sink, 0);
+			} else {
+				const idx_t child = info.child_index[idx_t(field)];
+				encoder.Write(info.plans[idx_t(field)], fmt.children[child], idx, sink);
+			}
+		}
+
+		uint8_t hash[32];
+		sink.sponge.finalize(hash);
+		result_data[row] = StringVector::AddStringOrBlob(result, const_char_ptr_cast(hash), 32);
+	}
+
+	if (args.AllConstant()) {
+		result.SetVectorType(VectorType::CONSTANT_VECTOR);
+	}
+}
+
+void RegisterTxHashFunctions(DatabaseInstance &db) {
+	ExtensionUtil::RegisterFunction(
+	    db, ScalarFunction("tx_hash", {LogicalType::ANY}, Bytes32Type(), TxHashFunction, TxHashBindHash));
+	ExtensionUtil::RegisterFunction(
+	    db, ScalarFunction("tx_signing_hash", {LogicalType::ANY}, Bytes32Type(), TxHashFunction, TxHashBindSigning));
+}
+
+} // namespace duckdb
@@ -0,0 +1,564 @@
+#include "read_evm_rpc.hpp"
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/function/table_function.hpp"
+#include "duckdb/main/extension_util.hpp"
+#include "fixed_bytes_utils.hpp"
+#include "yyjson.hpp"
+#include <atomic>
+
+namespace duckdb {
+
+static LogicalType AddressType() {
+	LogicalType t(LogicalTypeId::BLOB);
+	t.SetAlias("ADDRESS");
+	return t;
+}
+
+static LogicalType Bytes32Type() {
+	LogicalType t(LogicalTypeId::BLOB);
+	t.SetAlias("BYTES32");
+	return t;
+}
+
+static LogicalType Uint256Type() {
+	LogicalType t(LogicalTypeId::BLOB);
+	t.SetAlias("UINT256");
+	return t;
+}
+
+using duckdb_yyjson::yyjson_arr_iter;
+using duckdb_yyjson::yyjson_arr_iter_init;
+using duckdb_yyjson::yyjson_arr_iter_next;
+using duckdb_yyjson::yyjson_arr_size;
+using duckdb_yyjson::yyjson_doc;
+using duckdb_yyjson::yyjson_doc_free;
+using duckdb_yyjson::yyjson_doc_get_root;
+using duckdb_yyjson::yyjson_get_len;
+using duckdb_yyjson::yyjson_get_str;
+using duckdb_yyjson::yyjson_is_arr;
+using duckdb_yyjson::yyjson_is_null;
+using duckdb_yyjson::yyjson_is_obj;
+using duckdb_yyjson::yyjson_is_str;
+using duckdb_yyjson::yyjson_obj_get;
+using duckdb_yyjson::yyjson_read;
+using duckdb_yyjson::yyjson_val;
+
+// Files are split into ranges of this many bytes that scan threads claim one at a time. A range owns every line
+// that starts inside it, reading past its end to finish the last one
+static constexpr idx_t READ_EVM_RPC_RANGE_SIZE = 8 * 1024 * 1024;
+// Read size when finishing a line past the end of its range
+static constexpr idx_t READ_EVM_RPC_TAIL_SIZE = 64 * 1024;
+
+enum class EvmRpcKind : uint8_t { BLOCKS, TRANSACTIONS, RECEIPTS, LOGS };
+
+// How a JSON-RPC field is decoded: hex quantities into UBIGINT or UINT256, fixed-size data into ADDRESS or
+// BYTES32, variable-size data into BLOB, topic arrays into LIST(BYTES32), and COUNT for an array's length
+enum class EvmRpcField : uint8_t { QUANTITY, UINT256, ADDRESS, BYTES32, DATA, TOPICS, COUNT };
+
+struct EvmRpcColumn {
+	const char *name;
+	const char *key;
+	EvmRpcField field;
+};
+
+static const vector<EvmRpcColumn> BLOCK_COLUMNS = {
+    {"number", "number", EvmRpcField::QUANTITY},
+    {"hash", "hash", EvmRpcField::BYTES32},
+    {"parent_hash", "parentHash", EvmRpcField::BYTES32},
+    {"miner", "miner", EvmRpcField::ADDRESS},
+    {"timestamp", "timestamp", EvmRpcField::QUANTITY},
+    {"gas_limit", "gasLimit", EvmRpcField::QUANTITY},
+    {"gas_used", "gasUsed", EvmRpcField::QUANTITY},
+    {"base_fee_per_gas", "baseFeePerGas", EvmRpcField::UINT256},
+    {"transaction_count", "transactions", EvmRpcField::COUNT},
+};
+
+static const vector<EvmRpcColumn> TRANSACTION_COLUMNS = {
+    {"block_number", "blockNumber", EvmRpcField::QUANTITY},
+    {"block_hash", "blockHash", EvmRpcField::BYTES32},
+    {"transaction_index", "transactionIndex", EvmRpcField::QUANTITY},
+    {"hash", "hash", EvmRpcField::BYTES32},
+    {"type", "type", EvmRpcField::QUANTITY},
+    {"chain_id", "chainId", EvmRpcField::QUANTITY},
+    {"from_address", "from", EvmRpcField::ADDRESS},
+    {"to_address", "to", EvmRpcField::ADDRESS},
+    {"nonce", "nonce", EvmRpcField::QUANTITY},
+    {"value", "value", EvmRpcField::UINT256},
+    {"gas", "gas", EvmRpcField::QUANTITY},
+    {"gas_price", "gasPrice", EvmRpcField::UINT256},
+    {"max_fee_per_gas", "maxFeePerGas", EvmRpcField::UINT256},
+    {"max_priority_fee_per_gas", "maxPriorityFeePerGas", EvmRpcField::UINT256},
+    {"input", "input", EvmRpcField::DATA},
+};
+
+static const vector<EvmRpcColumn> RECEIPT_COLUMNS = {
+    {"block_number", "blockNumber", EvmRpcField::QUANTITY},
+    {"block_hash", "blockHash", EvmRpcField::BYTES32},
+    {"transaction_hash", "transactionHash", EvmRpcField::BYTES32},
+    {"transaction_index", "transactionIndex", EvmRpcField::QUANTITY},
+    {"type", "type", EvmRpcField::QUANTITY},
+    {"from_address", "from", EvmRpcField::ADDRESS},
+    {"to_address", "to", EvmRpcField::ADDRESS},
+    {"status", "status", EvmRpcField::QUANTITY},
+    {"gas_used", "gasUsed", EvmRpcField::QUANTITY},
+    {"cumulative_gas_used", "cumulativeGasUsed", EvmRpcField::QUANTITY},
+    {"effective_gas_price", "effectiveGasPrice", EvmRpcField::UINT256},
+    {"contract_address", "contractAddress", EvmRpcField::ADDRESS},
+    {"log_count", "logs", EvmRpcField::COUNT},
+};
+
+static const vector<EvmRpcColumn> LOG_COLUMNS = {
+    {"block_number", "blockNumber", EvmRpcField::QUANTITY},
+    {"transaction_hash", "transactionHash", EvmRpcField::BYTES32},
+    {"transaction_index", "transactionIndex", EvmRpcField::QUANTITY},
+    {"log_index", "logIndex", EvmRpcField::QUANTITY},
+    {"address", "address", EvmRpcField::ADDRESS},
+    {"topics", "topics", EvmRpcField::TOPICS},
+    {"data", "data", EvmRpcField::DATA},
+};
+
+static LogicalType FieldType(EvmRpcField field) {
+	switch (field) {
+	case EvmRpcField::QUANTITY:
+	case EvmRpcField::COUNT:
+		return LogicalType::UBIGINT;
+	case EvmRpcField::UINT256:
+		return Uint256Type();
+	case EvmRpcField::ADDRESS:
+		return AddressType();
+	case EvmRpcField::BYTES32:
+		return Bytes32Type();
+	case EvmRpcField::TOPICS:
+		return LogicalType::LIST(Bytes32Type());
+	default:
+		return LogicalType::BLOB;
+	}
+}
+
+struct ReadEvmRpcData : public TableFunctionData {
+	vector<string> paths;
+	EvmRpcKind kind;
+	const vector<EvmRpcColumn> *columns;
+};
+
+struct EvmRpcRange {
+	idx_t file;
+	idx_t begin;
+	idx_t end;
+};
+
+struct ReadEvmRpcGlobalState : public GlobalTableFunctionState {
+	vector<EvmRpcRange> ranges;
+	std::atomic<idx_t> next_range {0};
+	vector<column_t> column_ids;
+
+	idx_t MaxThreads() const override {
+		return MaxValue<idx_t>(ranges.size(), 1);
+	}
+};
+
+// The lines of the claimed range, and the rows of the line being emitted
+struct ReadEvmRpcLocalState : public LocalTableFunctionState {
+	~ReadEvmRpcLocalState() override {
+		yyjson_doc_free(doc);
+	}
+
+	idx_t file = 0;
+	// File offset of buffer[0]
+	idx_t buffer_offset = 0;
+	string buffer;
+	idx_t position = 0;
+	yyjson_doc *doc = nullptr;
+	vector<yyjson_val *> items;
+	idx_t item_index = 0;
+};
+
+static vector<string> GetPaths(const Value &input) {
+	vector<string> paths;
+	if (input.IsNull()) {
+		throw InvalidInputException("read_evm_rpc: paths cannot be NULL");
+	}
+	if (input.type().id() != LogicalTypeId::LIST) {
+		paths.push_back(StringValue::Get(input));
+		return paths;
+	}
+	for (auto &child : ListValue::GetChildren(input)) {
+		if (child.IsNull()) {
+			throw InvalidInputException("read_evm_rpc: paths cannot be NULL");
+		}
+		paths.push_back(StringValue::Get(child));
+	}
+	if (paths.empty()) {
+		throw InvalidInputException("read_evm_rpc: no files given");
+	}
+	return paths;
+}
+
+static unique_ptr<FunctionData> ReadEvmRpcBind(ClientContext &context, TableFunctionBindInput &input,
+                                               vector<LogicalType> &return_types, vector<string> &names) {
+	auto data = make_uniq<ReadEvmRpcData>();
+	data->paths = GetPaths(input.inputs[0]);
+
+	const string kind = input.inputs[1].IsNull() ? string() : StringUtil::Lower(StringValue::Get(input.inputs[1]));
+	if (kind == "blocks") {
+		data->kind = EvmRpcKind::BLOCKS;
+		data->columns = &BLOCK_COLUMNS;
+	} else if (kind == "transactions") {
+		data->kind = EvmRpcKind::TRANSACTIONS;
+		data->columns = &TRANSACTION_COLUMNS;
+	} else if (kind == "receipts") {
+		data->kind = EvmRpcKind::RECEIPTS;
+		data->columns = &RECEIPT_COLUMNS;
+	} else if (kind == "logs") {
+		data->kind = EvmRpcKind::LOGS;
+		data->columns = &LOG_COLUMNS;
+	} else {
+		throw InvalidInputException("read_evm_rpc: kind must be 'blocks', 'transactions', 'receipts' or 'logs'");
+	}
+
+	for (auto &column : *data->columns) {
+		return_types.push_back(FieldType(column.field));
+		names.push_back(column.name);
+	}
+	return std::move(data);
+}
+
+static unique_ptr<GlobalTableFunctionState> ReadEvmRpcInit(ClientContext &context, TableFunctionInitInput &input) {
+	auto &data = input.bind_data->Cast<ReadEvmRpcData>();
+	auto gstate = make_uniq<ReadEvmRpcGlobalState>();
+	gstate->column_ids = input.column_ids;
+
+	auto &fs = FileSystem::GetFileSystem(context);
+	for (idx_t file = 0; file < data.paths.size(); file++) {
+		auto handle = fs.OpenFile(data.paths[file], FileFlags::FILE_FLAGS_READ);
+		const idx_t file_size = handle->GetFileSize();
+		for (idx_t begin = 0; begin < file_size; begin += READ_EVM_RPC_RANGE_SIZE) {
+			gstate->ranges.push_back({file, begin, MinValue(begin + READ_EVM_RPC_RANGE_SIZE, file_size)});
+		}
+	}
+	return std::move(gstate);
+}
+
+static unique_ptr<LocalTableFunctionState> ReadEvmRpcInitLocal(ExecutionContext &context,
+                                                               TableFunctionInitInput &input,
+                                                               GlobalTableFunctionState *global_state) {
+	return make_uniq<ReadEvmRpcLocalState>();
+}
+
+// Reads the lines that start inside the range into the local buffer
+static void LoadRange(ClientContext &context, const ReadEvmRpcData &data, const EvmRpcRange &range,
+                      ReadEvmRpcLocalState &local) {
+	auto &fs = FileSystem::GetFileSystem(context);
+	auto handle = fs.OpenFile(data.paths[range.file], FileFlags::FILE_FLAGS_READ);
+	const idx_t file_size = handle->GetFileSize();
+
+	// The byte before the range tells whether a line starts at its first byte
+	const idx_t start = range.begin == 0 ? 0 : range.begin - 1;
+	local.file = range.file;
+	local.buffer_offset = start;
+	local.buffer.resize(range.end - start);
+	handle->Read(&local.buffer[0], local.buffer.size(), start);
+	local.position = local.buffer.size();
+
+	idx_t first = 0;
+	if (range.begin > 0) {
+		auto newline = local.buffer.find('\n');
+		if (newline == string::npos || newline + 1 == local.buffer.size()) {
+			// No line starts here, the next one (if any) belongs to the next range
+			return;
+		}
+		first = newline + 1;
+	}
+
+	// Finish the last line
+	idx_t end = range.end;
+	while (local.buffer.back() != '\n' && end < file_size) {
+		const idx_t old_size = local.buffer.size();
+		const idx_t extra = MinValue(READ_EVM_RPC_TAIL_SIZE, file_size - end);
+		local.buffer.resize(old_size + extra);
+		handle->Read(&local.buffer[old_size], extra, end);
+		end += extra;
+		auto newline = local.buffer.find('\n', old_size);
+		if (newline != string::npos) {
+			local.buffer.resize(newline + 1);
+		}
+	}
+	local.position = first;
+}
+
+static bool NextLine(ReadEvmRpcLocalState &local, const char *&line, idx_t &len) {
+	if (local.position >= local.buffer.size()) {
+		return false;
+	}
+	auto newline = local.buffer.find('\n', local.position);
+	const idx_t end = newline == string::npos ? local.buffer.size() : newline;
+	line = local.buffer.data() + local.position;
+	len = end - local.position;
+	local.position = end + 1;
+	return true;
+}
+
+static bool IsBlank(const char *line, idx_t len) {
+	for (idx_t i = 0; i < len; i++) {
+		if (!StringUtil::CharacterIsSpace(line[i])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// Results of a line: the line itself, the result of a JSON-RPC response, or the elements of a batch of either
+static void CollectResults(yyjson_val *val, vector<yyjson_val *> &results) {
+	if (yyjson_is_arr(val)) {
+		yyjson_arr_iter iter;
+		yyjson_arr_iter_init(val, &iter);
+		while (auto element = yyjson_arr_iter_next(&iter)) {
+			CollectResults(element, results);
+		}
+		return;
+	}
+	if (!yyjson_is_obj(val)) {
+		return;
+	}
+	if (yyjson_obj_get(val, "jsonrpc") || yyjson_obj_get(val, "result")) {
+		// Error responses and empty results have no rows
+		auto result = yyjson_obj_get(val, "result");
+		if (result) {
+			CollectResults(result, results);
+		}
+		return;
+	}
+	results.push_back(val);
+}
+
+// False when the array holds anything but objects, such as the transaction hashes of a block fetched without
+// full transactions
+static bool CollectArrayObjects(yyjson_val *arr, vector<yyjson_val *> &items) {
+	yyjson_arr_iter iter;
+	yyjson_arr_iter_init(arr, &iter);
+	while (auto element = yyjson_arr_iter_next(&iter)) {
+		if (!yyjson_is_obj(element)) {
+			return false;
+		}
+		items.push_back(element);
+	}
+	return true;
+}
+
+static bool HasArray(yyjson_val *result, const char *key) {
+	auto val = yyjson_obj_get(result, key);
+	return val && yyjson_is_arr(val);
+}
+
+// Rows of one result: a block; the full transactions of a block (or a transaction itself); a receipt; the logs
+// of a receipt (or a log itself, as returned by eth_getLogs). False when the result is of another kind
+static bool CollectItems(EvmRpcKind kind, yyjson_val *result, vector<yyjson_val *> &items) {
+	switch (kind) {
+	case EvmRpcKind::BLOCKS:
+		if (!yyjson_obj_get(result, "number")) {
+			return false;
+		}
+		items.push_back(result);
+		return true;
+	case EvmRpcKind::TRANSACTIONS:
+		if (HasArray(result, "transactions")) {
+			return CollectArrayObjects(yyjson_obj_get(result, "transactions"), items);
+		}
+		if (!yyjson_obj_get(result, "input")) {
+			return false;
+		}
+		items.push_back(result);
+		return true;
+	case EvmRpcKind::RECEIPTS:
+		if (!HasArray(result, "logs")) {
+			return false;
+		}
+		items.push_back(result);
+		return true;
+	case EvmRpcKind::LOGS:
+		if (HasArray(result, "logs")) {
+			return CollectArrayObjects(yyjson_obj_get(result, "logs"), items);
+		}
+		if (!yyjson_obj_get(result, "topics")) {
+			return false;
+		}
+		items.push_back(result);
+		return true;
+	}
+	return false;
+}
+
+static const char *KindDescription(EvmRpcKind kind) {
+	switch (kind) {
+	case EvmRpcKind::BLOCKS:
+		return "a block";
+	case EvmRpcKind::TRANSACTIONS:
+		return "a block with full transactions or a transaction";
+	case EvmRpcKind::RECEIPTS:
+		return "a receipt";
+	default:
+		return "a receipt or a log";
+	}
+}
+
+static void ParseLine(const ReadEvmRpcData &data, ReadEvmRpcLocalState &local, const char *line, idx_t len) {
+	const idx_t offset = local.buffer_offset + idx_t(line - local.buffer.data());
+	yyjson_doc_free(local.doc);
+	local.doc = yyjson_read(line, len, 0);
+	if (!local.doc) {
+		throw InvalidInputException("read_evm_rpc: invalid JSON in '%s' at byte %llu", data.paths[local.file], offset);
+	}
+	vector<yyjson_val *> results;
+	CollectResults(yyjson_doc_get_root(local.doc), results);
+	local.items.clear();
+	local.item_index = 0;
+	for (auto result : results) {
+		// Reading a file as the wrong kind fails instead of returning no rows
+		if (!CollectItems(data.kind, result, local.items)) {
+			throw InvalidInputException("read_evm_rpc: the result in '%s' at byte %llu is not %s",
+			                            data.paths[local.file], offset, KindDescription(data.kind));
+		}
+	}
+}
+
+// Decodes a 0x-prefixed hex string into SIZE bytes, left-padding short quantities
+template <idx_t SIZE>
+static bool DecodeHexValue(yyjson_val *val, uint8_t out[SIZE]) {
+	if (!yyjson_is_str(val)) {
+		return false;
+	}
+	const char *str = yyjson_get_str(val);
+	const idx_t len = yyjson_get_len(val);
+	return HasHexPrefix(str, len) && ParseHexToFixedBytes<SIZE>(str + 2, len - 2, out);
+}
+
+static void WriteField(const ReadEvmRpcData &data, const ReadEvmRpcLocalState &local, const EvmRpcColumn &column,
+                       yyjson_val *item, Vector &vec, idx_t row) {
+	auto val = yyjson_obj_get(item, column.key);
+	if (!val || yyjson_is_null(val)) {
+		FlatVector::SetNull(vec, row, true);
+		return;
+	}
+
+	bool valid = true;
+	switch (column.field) {
+	case EvmRpcField::COUNT:
+		if (!yyjson_is_arr(val)) {
+			FlatVector::SetNull(vec, row, true);
+			return;
+		}
+		FlatVector::GetData<uint64_t>(vec)[row] = yyjson_arr_size(val);
+		return;
+	case EvmRpcField::QUANTITY: {
+		uint8_t bytes[8] = {0};
+		valid = DecodeHexValue<8>(val, bytes);
+		uint64_t quantity = 0;
+		for (idx_t i = 0; i < 8; i++) {
+			quantity = quantity << 8 | bytes[i];
+		}
+		FlatVector::GetData<uint64_t>(vec)[row] = quantity;
+		break;
+	}
+	case EvmRpcField::UINT256:
+	case EvmRpcField::BYTES32: {
+		uint8_t bytes[32];
+		valid = DecodeHexValue<32>(val, bytes);
+		FlatVector::GetData<string_t>(vec)[row] = StringVector::AddStringOrBlob(vec, const_char_ptr_cast(bytes), 32);
+		break;
+	}
+	case EvmRpcField::ADDRESS: {
+		uint8_t bytes[20];
+		valid = DecodeHexValue<20>(val, bytes);
+		FlatVector::GetData<string_t>(vec)[row] = StringVector::AddStringOrBlob(vec, const_char_ptr_cast(bytes), 20);
+		break;
+	}
+	case EvmRpcField::DATA: {
+		const char *str = yyjson_is_str(val) ? yyjson_get_str(val) : nullptr;
+		const idx_t len = str ? yyjson_get_len(val) : 0;
+		valid = str && HasHexPrefix(str, len) && len % 2 == 0;
+		if (valid) {
+			auto blob = StringVector::EmptyString(vec, (len - 2) / 2);
+			valid = HexCodec::Decode(str + 2, blob.GetSize(), data_ptr_cast(blob.GetDataWriteable()));
+			blob.Finalize();
+			FlatVector::GetData<string_t>(vec)[row] = blob;
+		}
+		break;
+	}
+	case EvmRpcField::TOPICS: {
+		if (!yyjson_is_arr(val)) {
+			valid = false;
+			break;
+		}
+		const idx_t offset = ListVector::GetListSize(vec);
+		const idx_t topics = yyjson_arr_size(val);
+		ListVector::Reserve(vec, offset + topics);
+		auto &child = ListVector::GetEntry(vec);
+		auto child_data = FlatVector::GetData<string_t>(child);
+		yyjson_arr_iter iter;
+		yyjson_arr_iter_init(val, &iter);
+		for (idx_t i = 0; i < topics && valid; i++) {
+			uint8_t bytes[32];
+			valid = DecodeHexValue<32>(yyjson_arr_iter_next(&iter), bytes);
+			child_data[offset + i] = StringVector::AddStringOrBlob(child, const_char_ptr_cast(bytes), 32);
+		}
+		FlatVector::GetData<list_entry_t>(vec)[row] = list_entry_t(offset, topics);
+		ListVector::SetListSize(vec, offset + topics);
+		break;
+	}
+	}
+	if (!valid) {
+		throw InvalidInputException("read_evm_rpc: field '%s' in '%s' is not a hex value of the expected size",
+		                            column.key, data.paths[local.file]);
+	}
+}
+
+static void ReadEvmRpcFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.bind_data->Cast<ReadEvmRpcData>();
+	auto &gstate = data_p.global_state->Cast<ReadEvmRpcGlobalState>();
+	auto &local = data_p.local_state->Cast<ReadEvmRpcLocalState>();
+	auto &columns = *data.columns;
+
+	idx_t count = 0;
+	while (count < STANDARD_VECTOR_SIZE) {
+		if (local.item_index < local.items.size()) {
+			auto item = local.items[local.item_index++];
+			for (idx_t col = 0; col < gstate.column_ids.size(); col++) {
+				const auto column_id = gstate.column_ids[col];
+				if (column_id < columns.size()) {
+					WriteField(data, local, columns[column_id], item, output.data[col], count);
+				}
+			}
+			count++;
+			continue;
+		}
+
+		const char *line;
+		idx_t len;
+		if (NextLine(local, line, len)) {
+			if (!IsBlank(line, len)) {
+				ParseLine(data, local, line, len);
+			}
+			continue;
+		}
+		const idx_t range = gstate.next_range.fetch_add(1);
+		if (range >= gstate.ranges.size()) {
+			break;
+		}
+		LoadRange(context, data, gstate.ranges[range], local);
+	}
+	output.SetCardinality(count);
+}
+
+void RegisterReadEvmRpcFunction(DatabaseInstance &db) {
+	TableFunctionSet read_set("read_evm_rpc");
+	for (auto &paths_type : vector<LogicalType> {LogicalType::VARCHAR, LogicalType::LIST(LogicalType::VARCHAR)}) {
+		TableFunction function({paths_type, LogicalType::VARCHAR}, ReadEvmRpcFunction, ReadEvmRpcBind,
+		                       ReadEvmRpcInit, ReadEvmRpcInitLocal);
+		function.projection_pushdown = true;
+		read_set.AddFunction(function);
+	}
+	ExtensionUtil::RegisterFunction(db, read_set);
+}
+
+} // namespace duckdb
@@ -0,0 +1,185 @@
+#include "ecrecover.hpp"
+#include "secp256k1.hpp"
+#include "duckdb/main/extension_util.hpp"
+#include "duckdb/common/vector_operations/unary_executor.hpp"
+#include "duckdb/function/scalar_function.hpp"
+#include "keccak.hpp"
+
+namespace duckdb {
+
+static LogicalType AddressType() {
+	LogicalType t(LogicalTypeId::BLOB);
+	t.SetAlias("ADDRESS");
+	return t;
+}
+
+static constexpr idx_t FIELD_BYTES = 32;
+static constexpr idx_t ADDRESS_BYTES = 20;
+
+// The address of a public key is the last 20 bytes of keccak256(x || y)
+static inline string_t PublicKeyToAddress(Vector &result, const uint8_t key[2 * FIELD_BYTES]) {
+	uint8_t hash[32];
+	Keccak::Hash256Fixed<2 * FIELD_BYTES>(key, hash);
+	return StringVector::AddStringOrBlob(result, const_char_ptr_cast(hash + 32 - ADDRESS_BYTES), ADDRESS_BYTES);
+}
+
+// Accepts raw 64-byte keys, SEC1 uncompressed (0x04 prefix) and SEC1 compressed (0x02/0x03 prefix) keys.
+// Compressed keys are decompressed and so checked against the curve, uncompressed ones are hashed as given
+static void PubkeyToAddressFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	UnaryExecutor::ExecuteWithNulls<string_t, string_t>(
+	    args.data[0], result, args.size(), [&](string_t key, ValidityMask &mask, idx_t row) {
+		    auto data = const_data_ptr_cast(key.GetData());
+		    switch (key.GetSize()) {
+		    case 2 * FIELD_BYTES:
+			    return PublicKeyToAddress(result, data);
+		    case 2 * FIELD_BYTES + 1:
+			    if (data[0] == 0x04) {
+				    return PublicKeyToAddress(result, data + 1);
+			    }
+			    break;
+		    case FIELD_BYTES + 1:
+			    if (data[0] == 0x02 || data[0] == 0x03) {
+				    const auto x = intx::be::unsafe::load<intx::uint256>(data + 1);
+				    intx::uint256 y;
+				    if (Secp256k1::LiftX(x, data[0] == 0x03, y)) {
+					    uint8_t point[2 * FIELD_BYTES];
+					    intx::be::unsafe::store(point, x);
+					    intx::be::unsafe::store(point + FIELD_BYTES, y);
+					    return PublicKeyToAddress(result, point);
+				    }
+			    }
+			    break;
+		    default:
+			    break;
+		    }
+		    mask.SetInvalid(row);
+		    return string_t();
+	    });
+}
+
+// Recovery id (parity of R's y) from v as 0/1, 27/28 or EIP-155 (chain_id * 2 + 35/36), -1 when invalid
+static inline int RecoveryId(int64_t v) {
+	if (v == 0 || v == 1) {
+		return int(v);
+	}
+	if (v == 27 || v == 28) {
+		return int(v - 27);
+	}
+	if (v >= 35) {
+		return int((v - 35) & 1);
+	}
+	return -1;
+}
+
+// A signature that passed the checks of the first pass, waiting for its batched inversions
+struct PendingRecovery {
+	idx_t row;
+	intx::uint256 z;
+	intx::uint256 s;
+	Secp256k1::Point r_point;
+};
+
+// Q = r^-1 * (s * R - z * G). The chunk goes through three passes so that every modular inversion is shared:
+// r^-1 mod n for all rows at once, then the Z coordinates of all Q at once for the conversion to affine
+static void EcrecoverFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	const idx_t count = args.size();
+	UnifiedVectorFormat hash_fmt, v_fmt, r_fmt, s_fmt;
+	args.data[0].ToUnifiedFormat(count, hash_fmt);
+	args.data[1].ToUnifiedFormat(count, v_fmt);
+	args.data[2].ToUnifiedFormat(count, r_fmt);
+	args.data[3].ToUnifiedFormat(count, s_fmt);
+	auto hash_data = UnifiedVectorFormat::GetData<string_t>(hash_fmt);
+	auto v_data = UnifiedVectorFormat::GetData<int64_t>(v_fmt);
+	auto r_data = UnifiedVectorFormat::GetData<string_t>(r_fmt);
+	auto s_data = UnifiedVectorFormat::GetData<string_t>(s_fmt);
+
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto result_data = FlatVector::GetData<string_t>(result);
+	auto &result_mask = FlatVector::Validity(result);
+
+	vector<PendingRecovery> pending;
+	std::vector<intx::uint256> inverses;
+	pending.reserve(count);
+	inverses.reserve(count);
+	for (idx_t row = 0; row < count; row++) {
+		auto hash_idx = hash_fmt.sel->get_index(row);
+		auto v_idx = v_fmt.sel->get_index(row);
+		auto r_idx = r_fmt.sel->get_index(row);
+		auto s_idx = s_fmt.sel->get_index(row);
+		result_mask.SetInvalid(row);
+		if (!hash_fmt.validity.RowIsValid(hash_idx) || !v_fmt.validity.RowIsValid(v_idx) ||
+		    !r_fmt.validity.RowIsValid(r_idx) || !s_fmt.validity.RowIsValid(s_idx)) {
+			continue;
+		}
+		auto &hash = hash_data[hash_idx];
+		auto &r_blob = r_data[r_idx];
+		auto &s_blob = s_data[s_idx];
+		const int recovery_id = RecoveryId(v_data[v_idx]);
+		if (hash.GetSize() != FIELD_BYTES || r_blob.GetSize() != FIELD_BYTES || s_blob.GetSize() != FIELD_BYTES ||
+		    recovery_id < 0) {
+			continue;
+		}
+		PendingRecovery recovery;
+		recovery.row = row;
+		const auto r = intx::be::unsafe::load<intx::uint256>(const_data_ptr_cast(r_blob.GetData()));
+		recovery.s = intx::be::unsafe::load<intx::uint256>(const_data_ptr_cast(s_blob.GetData()));
+		if (r == 0 || r >= Secp256k1::N || recovery.s == 0 || recovery.s >= Secp256k1::N) {
+			continue;
+		}
+		recovery.r_point = Secp256k1::Point {r, 0, 1};
+		if (!Secp256k1::LiftX(r, recovery_id == 1, recovery.r_point.y)) {
+			continue;
+		}
+		recovery.z = intx::be::unsafe::load<intx::uint256>(const_data_ptr_cast(hash.GetData()));
+		if (recovery.z >= Secp256k1::N) {
+			recovery.z -= Secp256k1::N;
+		}
+		pending.push_back(recovery);
+		inverses.push_back(r);
+	}
+
+	Secp256k1::BatchInverse(inverses, Secp256k1::ScalarMul, Secp256k1::ScalarInverse);
+	for (idx_t i = 0; i < pending.size(); i++) {
+		auto &recovery = pending[i];
+		auto u1 = Secp256k1::ScalarMul(recovery.z, inverses[i]);
+		u1 = u1 == 0 ? u1 : Secp256k1::N - u1;
+		const auto u2 = Secp256k1::ScalarMul(recovery.s, inverses[i]);
+		// The recovered key replaces R, which is no longer needed
+		recovery.r_point = Secp256k1::DoubleMultiply(u1, u2, recovery.r_point);
+	}
+
+	// The point at infinity has no address; it is dropped so the batch only inverts non-zero Z
+	idx_t kept = 0;
+	for (auto &recovery : pending) {
+		if (!recovery.r_point.IsInfinity()) {
+			inverses[kept] = recovery.r_point.z;
+			pending[kept++] = recovery;
+		}
+	}
+	pending.resize(kept);
+	inverses.resize(kept);
+	Secp256k1::BatchInverse(inverses, Secp256k1::Mul, Secp256k1::Inverse);
+	for (idx_t i = 0; i < pending.size(); i++) {
+		auto &q = pending[i].r_point;
+		const auto z_inv2 = Secp256k1::Sqr(inverses[i]);
+		uint8_t key[2 * FIELD_BYTES];
+		intx::be::unsafe::store(key, Secp256k1::Mul(q.x, z_inv2));
+		intx::be::unsafe::store(key + FIELD_BYTES, Secp256k1::Mul(q.y, Secp256k1::Mul(z_inv2, inverses[i])));
+		result_data[pending[i].row] = PublicKeyToAddress(result, key);
+		result_mask.SetValid(pending[i].row);
+	}
+
+	if (args.AllConstant()) {
+		result.SetVectorType(VectorType::CONSTANT_VECTOR);
+	}
+}
+
+void RegisterEcrecoverFunctions(DatabaseInstance &db) {
+	ExtensionUtil::RegisterFunction(db, ScalarFunction("pubkey_to_address", {LogicalType::BLOB}, AddressType(),
+	                                                   PubkeyToAddressFunction));
+	ExtensionUtil::RegisterFunction(
+	    db, ScalarFunction("ecrecover", {LogicalType::BLOB, LogicalType::BIGINT, LogicalType::BLOB, LogicalType::BLOB},
+	                       AddressType(), EcrecoverFunction));
+}
+
+} // namespace duckdb
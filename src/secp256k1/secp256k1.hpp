@@ -0,0 +1,238 @@
+#pragma once
+
+#include <intx.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace duckdb {
+
+// Arithmetic on the secp256k1 curve y^2 = x^3 + 7 over intx 256-bit integers. Field elements are kept fully
+// reduced; points are in Jacobian coordinates (X, Y, Z) ~ (X / Z^2, Y / Z^3), with Z == 0 the point at infinity
+class Secp256k1 {
+public:
+	using uint256 = intx::uint256;
+
+	struct Point {
+		uint256 x;
+		uint256 y;
+		uint256 z;
+
+		bool IsInfinity() const {
+			return z == 0;
+		}
+	};
+
+	static constexpr uint256 P {0xFFFFFFFEFFFFFC2FULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL,
+	                            0xFFFFFFFFFFFFFFFFULL};
+	static constexpr uint256 N {0xBFD25E8CD0364141ULL, 0xBAAEDCE6AF48A03BULL, 0xFFFFFFFFFFFFFFFEULL,
+	                            0xFFFFFFFFFFFFFFFFULL};
+	static constexpr uint256 GX {0x59F2815B16F81798ULL, 0x029BFCDB2DCE28D9ULL, 0x55A06295CE870B07ULL,
+	                             0x79BE667EF9DCBBACULL};
+	static constexpr uint256 GY {0x9C47D08FFB10D4B8ULL, 0xFD17B448A6855419ULL, 0x5DA4FBFC0E1108A8ULL,
+	                             0x483ADA7726A3C465ULL};
+	// 2^256 - P, so 2^256 == C (mod P)
+	static constexpr uint64_t C = 0x1000003D1ULL;
+	// Bits of a scalar consumed per table lookup in Multiply
+	static constexpr unsigned WINDOW_BITS = 4;
+	static constexpr unsigned WINDOW_SIZE = 1u << WINDOW_BITS;
+
+	// Field arithmetic mod P
+
+	static inline uint256 Reduce(const intx::uint512 &x) {
+		const auto lo = static_cast<uint256>(x);
+		const auto hi = static_cast<uint256>(x >> 256);
+		// hi * 2^256 + lo == hi * C + lo, which is below 2^291
+		auto t = intx::uint320(hi) * intx::uint320(C) + intx::uint320(lo);
+		// Fold the remaining 35 bits the same way
+		auto sum = intx::addc(static_cast<uint256>(t), uint256(intx::umul(t[4], C)));
+		auto r = sum.value;
+		if (sum.carry) {
+			r += C;
+		}
+		return r >= P ? r - P : r;
+	}
+
+	static inline uint256 Mul(const uint256 &a, const uint256 &b) {
+		return Reduce(intx::umul(a, b));
+	}
+
+	static inline uint256 Sqr(const uint256 &a) {
+		return Reduce(intx::umul(a, a));
+	}
+
+	static inline uint256 Add(const uint256 &a, const uint256 &b) {
+		auto sum = intx::addc(a, b);
+		if (sum.carry) {
+			return sum.value + C;
+		}
+		return sum.value >= P ? sum.value - P : sum.value;
+	}
+
+	static inline uint256 Sub(const uint256 &a, const uint256 &b) {
+		auto diff = intx::subc(a, b);
+		// On borrow the result wrapped by 2^256, adding P is subtracting C
+		return diff.carry ? diff.value - C : diff.value;
+	}
+
+	static inline uint256 Pow(uint256 base, const uint256 &exponent) {
+		uint256 result = 1;
+		for (int bit = 255; bit >= 0; bit--) {
+			result = Sqr(result);
+			if ((exponent[bit / 64] >> (bit % 64)) & 1) {
+				result = Mul(result, base);
+			}
+		}
+		return result;
+	}
+
+	static inline uint256 Inverse(const uint256 &a) {
+		return Pow(a, P - 2);
+	}
+
+	// Square root of a, false when a is not a square. P = 3 mod 4, so it is a^((P + 1) / 4)
+	static inline bool Sqrt(const uint256 &a, uint256 &root) {
+		root = Pow(a, (P + 1) >> 2);
+		return Sqr(root) == a;
+	}
+
+	// y of the curve point with the given x and y parity, false when x is not on the curve
+	static inline bool LiftX(const uint256 &x, bool odd, uint256 &y) {
+		if (x >= P || !Sqrt(Add(Mul(Sqr(x), x), 7), y)) {
+			return false;
+		}
+		if (bool(y[0] & 1) != odd) {
+			y = y == 0 ? y : P - y;
+		}
+		return true;
+	}
+
+	// Group law (a = 0)
+
+	static inline Point Double(const Point &p) {
+		if (p.IsInfinity() || p.y == 0) {
+			return Point {0, 0, 0};
+		}
+		const auto a = Sqr(p.x);
+		const auto b = Sqr(p.y);
+		const auto c = Sqr(b);
+		auto d = Sub(Sub(Sqr(Add(p.x, b)), a), c);
+		d = Add(d, d);
+		const auto e = Add(Add(a, a), a);
+		const auto x3 = Sub(Sqr(e), Add(d, d));
+		auto c8 = Add(c, c);
+		c8 = Add(c8, c8);
+		c8 = Add(c8, c8);
+		const auto y3 = Sub(Mul(e, Sub(d, x3)), c8);
+		const auto yz = Mul(p.y, p.z);
+		return Point {x3, y3, Add(yz, yz)};
+	}
+
+	static inline Point AddPoints(const Point &p, const Point &q) {
+		if (p.IsInfinity()) {
+			return q;
+		}
+		if (q.IsInfinity()) {
+			return p;
+		}
+		const auto pz2 = Sqr(p.z);
+		const auto qz2 = Sqr(q.z);
+		const auto u1 = Mul(p.x, qz2);
+		const auto u2 = Mul(q.x, pz2);
+		const auto s1 = Mul(p.y, Mul(q.z, qz2));
+		const auto s2 = Mul(q.y, Mul(p.z, pz2));
+		if (u1 == u2) {
+			return s1 == s2 ? Double(p) : Point {0, 0, 0};
+		}
+		const auto h = Sub(u2, u1);
+		const auto r = Sub(s2, s1);
+		const auto h2 = Sqr(h);
+		const auto h3 = Mul(h2, h);
+		const auto u1h2 = Mul(u1, h2);
+		const auto x3 = Sub(Sub(Sqr(r), h3), Add(u1h2, u1h2));
+		const auto y3 = Sub(Mul(r, Sub(u1h2, x3)), Mul(s1, h3));
+		return Point {x3, y3, Mul(h, Mul(p.z, q.z))};
+	}
+
+	// Multiples 0..WINDOW_SIZE-1 of p
+	static inline void BuildTable(const Point &p, Point table[WINDOW_SIZE]) {
+		table[0] = Point {0, 0, 0};
+		table[1] = p;
+		for (unsigned i = 2; i < WINDOW_SIZE; i++) {
+			table[i] = (i & 1) ? AddPoints(table[i - 1], p) : Double(table[i / 2]);
+		}
+	}
+
+	static const Point *GeneratorTable() {
+		static const auto table = [] {
+			std::vector<Point> t(WINDOW_SIZE);
+			BuildTable(Point {GX, GY, 1}, t.data());
+			return t;
+		}();
+		return table.data();
+	}
+
+	// u1 * G + u2 * Q with fixed 4-bit windows, both scalars sharing the doublings
+	static inline Point DoubleMultiply(const uint256 &u1, const uint256 &u2, const Point &q) {
+		Point q_table[WINDOW_SIZE];
+		BuildTable(q, q_table);
+		auto g_table = GeneratorTable();
+
+		Point acc {0, 0, 0};
+		for (int window = 256 / WINDOW_BITS - 1; window >= 0; window--) {
+			for (unsigned i = 0; i < WINDOW_BITS; i++) {
+				acc = Double(acc);
+			}
+			const unsigned shift = (window * WINDOW_BITS) % 64;
+			const unsigned word = (window * WINDOW_BITS) / 64;
+			const auto d1 = (u1[word] >> shift) & (WINDOW_SIZE - 1);
+			const auto d2 = (u2[word] >> shift) & (WINDOW_SIZE - 1);
+			if (d1) {
+				acc = AddPoints(acc, g_table[d1]);
+			}
+			if (d2) {
+				acc = AddPoints(acc, q_table[d2]);
+			}
+		}
+		return acc;
+	}
+
+	// Scalar arithmetic mod N, only needed a few times per signature
+
+	static inline uint256 ScalarMul(const uint256 &a, const uint256 &b) {
+		return intx::mulmod(a, b, N);
+	}
+
+	static inline uint256 ScalarInverse(const uint256 &a) {
+		uint256 result = 1;
+		const auto exponent = N - 2;
+		for (int bit = 255; bit >= 0; bit--) {
+			result = ScalarMul(result, result);
+			if ((exponent[bit / 64] >> (bit % 64)) & 1) {
+				result = ScalarMul(result, a);
+			}
+		}
+		return result;
+	}
+
+	// Replaces every (non-zero) value by its inverse with a single inversion (Montgomery's trick)
+	template <class MUL, class INVERSE>
+	static void BatchInverse(std::vector<uint256> &values, MUL mul, INVERSE inverse) {
+		if (values.empty()) {
+			return;
+		}
+		std::vector<uint256> prefix(values.size());
+		prefix[0] = values[0];
+		for (size_t i = 1; i < values.size(); i++) {
+			prefix[i] = mul(prefix[i - 1], values[i]);
+		}
+		auto inv = inverse(prefix.back());
+		for (size_t i = values.size() - 1; i > 0; i--) {
+			const auto value = values[i];
+			values[i] = mul(inv, prefix[i - 1]);
+			inv = mul(inv, value);
+		}
+		values[0] = inv;
+	}
+};
+
+} // namespace duckdb
@@ -39,21 +39,9 @@ void RegisterAddressType(DatabaseInstance &db) {
 	    }),
 	    10);
 
-	ExtensionUtil::RegisterCastFunction(
-	    db, LogicalType::BLOB, AddressType(),
-	    BoundCastInfo([](Vector &source, Vector &result, idx_t count, CastParameters &parameters) {
-		    // BLOB -> ADDRESS requires size validation
-		    UnaryExecutor::ExecuteWithNulls<string_t, string_t>(
-		        source, result, count, [&](const string_t &input, ValidityMask &mask, idx_t idx) {
-			        if (input.GetSize() != ADDRESS_SIZE) {
-				        mask.SetInvalid(idx);
-				        return string_t();
-			        }
-			        return input;
-		        });
-		    return true;
-	    }),
-	    10);
+	// BLOB -> ADDRESS requires size validation
+	ExtensionUtil::RegisterCastFunction(db, LogicalType::BLOB, AddressType(),
+	                                    BoundCastInfo(CastBlobToFixedBytes<ADDRESS_SIZE>), 10);
 }
 
 } // namespace duckdb
\ No newline at end of file
@@ -38,20 +38,8 @@ void RegisterBytes4Type(DatabaseInstance &db) {
 	    }),
 	    10);
 
-	ExtensionUtil::RegisterCastFunction(
-	    db, LogicalType::BLOB, Bytes4Type(),
-	    BoundCastInfo([](Vector &source, Vector &result, idx_t count, CastParameters &parameters) {
-		    UnaryExecutor::ExecuteWithNulls<string_t, string_t>(
-		        source, result, count, [&](const string_t &input, ValidityMask &mask, idx_t idx) {
-			        if (input.GetSize() != BYTE4_SIZE) {
-				        mask.SetInvalid(idx);
-				        return string_t();
-			        }
-			        return input;
-		        });
-		    return true;
-	    }),
-	    10);
+	ExtensionUtil::RegisterCastFunction(db, LogicalType::BLOB, Bytes4Type(),
+	                                    BoundCastInfo(CastBlobToFixedBytes<BYTE4_SIZE>), 10);
 }
 
 } // namespace duckdb
@@ -4,6 +4,7 @@
 #include "bytes4.hpp"
 #include "cross_casts.hpp"
 #include "uint265.hpp"
+#include "uint256_aggregates.hpp"
 
 namespace duckdb {
 
@@ -12,6 +13,7 @@ void RegisterEvmTypes(DatabaseInstance &db) {
 	RegisterBytes4Type(db);
 	RegisterBytes32Type(db);
 	RegisterUint256Type(db);
+	RegisterUint256Aggregates(db);
 	RegisterCrossTypeCasts(db);
 }
 
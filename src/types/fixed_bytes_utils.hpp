@@ -3,97 +3,140 @@
 #include "duckdb/main/extension_util.hpp"
 #include "duckdb/common/types/blob.hpp"
 #include "duckdb/function/scalar_function.hpp"
+#include "hex_codec.hpp"
+#include <cstring>
 
 namespace duckdb {
 
-static inline int HexVal(unsigned char c) {
-	if (c >= '0' && c <= '9') {
-		return c - '0';
+// Fixed-width result storage for a whole chunk: one string heap allocation of count * WIDTH bytes that every row
+// is written into in place. Widths short enough to be inlined in the string_t need no heap at all
+template <idx_t WIDTH>
+class FixedWidthResultWriter {
+public:
+	FixedWidthResultWriter(Vector &result, idx_t count) {
+		if (!INLINED && count > 0) {
+			auto block = StringVector::EmptyString(result, count * WIDTH);
+			base = data_ptr_cast(block.GetDataWriteable());
+		}
+	}
+
+	inline data_ptr_t Slot(idx_t row) {
+		return INLINED ? scratch : base + row * WIDTH;
 	}
-	c |= 0x20; // to lower
-	if (c >= 'a' && c <= 'f') {
-		return 10 + (c - 'a');
+
+	// Returns the string_t for a slot that has been filled
+	inline string_t Get(idx_t row) {
+		return string_t(const_char_ptr_cast(Slot(row)), WIDTH);
 	}
-	return -1;
+
+private:
+	static constexpr bool INLINED = WIDTH <= string_t::INLINE_LENGTH;
+	data_ptr_t base = nullptr;
+	uint8_t scratch[WIDTH];
+};
+
+// Parses up to SIZE*2 hex chars (no prefix) into out, left-padding with zeros. Shorter and odd-length input is
+// right-aligned behind '0' digits so that every length goes through the same vectorized decode
+template <idx_t SIZE>
+static bool ParseHexToFixedBytes(const char *p, idx_t len, uint8_t *out) {
+	if (len == SIZE * 2) {
+		return HexCodec::Decode(p, SIZE, out);
+	}
+	// Can't be more than SIZE*2 hex chars
+	if (len > SIZE * 2) {
+		return false;
+	}
+	char padded[SIZE * 2];
+	memset(padded, '0', SIZE * 2 - len);
+	memcpy(padded + SIZE * 2 - len, p, len);
+	return HexCodec::Decode(padded, SIZE, out);
 }
 
-static constexpr char HEX_LOWER[] = "0123456789abcdef";
+static inline bool HasHexPrefix(const char *p, idx_t len) {
+	return len >= 2 && p[0] == '0' && (p[1] == 'x' || p[1] == 'X');
+}
 
 template <idx_t SIZE>
 static bool CastVarcharToFixedBytes(Vector &source, Vector &result, idx_t count, CastParameters &parameters) {
+	FixedWidthResultWriter<SIZE> writer(result, count);
 	UnaryExecutor::ExecuteWithNulls<string_t, string_t>(
 	    source, result, count, [&](const string_t &input, ValidityMask &mask, idx_t idx) {
 		    const char *p = input.GetData();
 		    idx_t len = input.GetSize();
 
 		    // Skip 0x prefix if present
-		    if (len >= 2 && p[0] == '0' && (p[1] == 'x' || p[1] == 'X')) {
+		    if (HasHexPrefix(p, len)) {
 			    p += 2;
 			    len -= 2;
 		    }
 
-		    // Can't be more than SIZE*2 hex chars
-		    if (len > SIZE * 2) {
+		    if (!ParseHexToFixedBytes<SIZE>(p, len, writer.Slot(idx))) {
 			    mask.SetInvalid(idx);
 			    return string_t();
 		    }
+		    return writer.Get(idx);
+	    });
+	return true;
+}
 
-		    uint8_t out[SIZE] {}; // Zero-initialized for left-padding
-
-		    // Parse from right to left to handle left-padding correctly
-		    idx_t w = SIZE;
-		    idx_t i = len;
-
-		    while (i > 0) {
-			    int lo = HexVal(static_cast<unsigned char>(p[--i]));
-			    if (lo < 0) {
-				    mask.SetInvalid(idx);
-				    return string_t();
-			    }
-
-			    int hi = 0;
-			    if (i > 0) {
-				    int v = HexVal(static_cast<unsigned char>(p[--i]));
-				    if (v < 0) {
-					    mask.SetInvalid(idx);
-					    return string_t();
-				    }
-				    hi = v;
-			    }
-
-			    if (w == 0) {
-				    mask.SetInvalid(idx);
-				    return string_t();
-			    }
-
-			    out[--w] = static_cast<uint8_t>((hi << 4) | lo);
+template <idx_t SIZE>
+static bool CastFixedBytesToVarchar(Vector &source, Vector &result, idx_t count, CastParameters &parameters) {
+	FixedWidthResultWriter<2 + SIZE * 2> writer(result, count);
+	UnaryExecutor::ExecuteWithNulls<string_t, string_t>(
+	    source, result, count, [&](const string_t &blob, ValidityMask &mask, idx_t idx) {
+		    if (blob.GetSize() != SIZE) {
+			    throw InvalidInputException("Invalid bytes size");
 		    }
 
-		    return StringVector::AddStringOrBlob(result, const_char_ptr_cast(out), SIZE);
+		    auto out = char_ptr_cast(writer.Slot(idx)); // "0x" + hex chars
+		    out[0] = '0';
+		    out[1] = 'x';
+		    HexCodec::Encode(const_data_ptr_cast(blob.GetData()), SIZE, out + 2);
+		    return writer.Get(idx);
 	    });
 	return true;
 }
 
+// True when every valid row is exactly SIZE bytes long. Flat vectors without NULLs, which is how Parquet
+// FIXED_LEN_BYTE_ARRAY columns arrive, fold the size fields with a branch-free OR that the compiler vectorizes
 template <idx_t SIZE>
-static bool CastFixedBytesToVarchar(Vector &source, Vector &result, idx_t count, CastParameters &parameters) {
-	UnaryExecutor::Execute<string_t, string_t>(source, result, count, [&](const string_t &blob) {
-		if (blob.GetSize() != SIZE) {
-			throw InvalidInputException("Invalid bytes size");
+static bool AllRowsHaveSize(const UnifiedVectorFormat &fmt, idx_t count) {
+	auto data = UnifiedVectorFormat::GetData<string_t>(fmt);
+	uint32_t mismatch = 0;
+	if (!fmt.sel->IsSet() && fmt.validity.AllValid()) {
+		for (idx_t i = 0; i < count; i++) {
+			mismatch |= data[i].GetSize() ^ uint32_t(SIZE);
 		}
-
-		const auto *data = const_data_ptr_cast(blob.GetData());
-		char out[2 + SIZE * 2]; // "0x" + hex chars
-		out[0] = '0';
-		out[1] = 'x';
-
-		for (idx_t j = 0; j < SIZE; j++) {
-			uint8_t b = data[j];
-			out[2 + j * 2] = HEX_LOWER[b >> 4];
-			out[2 + j * 2 + 1] = HEX_LOWER[b & 0x0F];
+		return mismatch == 0;
+	}
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = fmt.sel->get_index(i);
+		if (fmt.validity.RowIsValid(idx)) {
+			mismatch |= data[idx].GetSize() ^ uint32_t(SIZE);
 		}
+	}
+	return mismatch == 0;
+}
 
-		return StringVector::AddString(result, out, 2 + SIZE * 2);
-	});
+// BLOB -> fixed-width type, blobs of any other size become NULL. When all rows already have the right size the
+// result references the source, keeping its vector type and string data untouched. This only makes the cast
+// cheaper: a filter on the cast value is evaluated row by row and does not prune Parquet row groups
+template <idx_t SIZE>
+static bool CastBlobToFixedBytes(Vector &source, Vector &result, idx_t count, CastParameters &parameters) {
+	UnifiedVectorFormat fmt;
+	source.ToUnifiedFormat(count, fmt);
+	if (AllRowsHaveSize<SIZE>(fmt, count)) {
+		result.Reference(source);
+		return true;
+	}
+	UnaryExecutor::ExecuteWithNulls<string_t, string_t>(
+	    source, result, count, [&](const string_t &input, ValidityMask &mask, idx_t idx) {
+		    if (input.GetSize() != SIZE) {
+			    mask.SetInvalid(idx);
+			    return string_t();
+		    }
+		    return input;
+	    });
 	return true;
 }
 
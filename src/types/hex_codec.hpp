@@ -0,0 +1,140 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define QUACKECCAK_HEX_SSE2 1
+#endif
+
+namespace duckdb {
+
+// Nibble value per char, INVALID (high bits set) for anything that is not a hex digit
+struct HexDecodeTable {
+	static constexpr uint8_t INVALID = 0xF0;
+	uint8_t values[256];
+
+	constexpr HexDecodeTable() : values {} {
+		for (int c = 0; c < 256; c++) {
+			values[c] = INVALID;
+		}
+		for (int c = '0'; c <= '9'; c++) {
+			values[c] = uint8_t(c - '0');
+		}
+		for (int c = 0; c < 6; c++) {
+			values['a' + c] = uint8_t(10 + c);
+			values['A' + c] = uint8_t(10 + c);
+		}
+	}
+
+	constexpr uint8_t operator[](uint8_t c) const {
+		return values[c];
+	}
+};
+
+// Hex digit pairs <-> bytes for the fixed-width EVM types. SSE2 is part of the x86-64 baseline, so the vector
+// paths need no extra compiler flags or runtime dispatch; other targets use the table-driven scalar loop
+class HexCodec {
+public:
+	// Decodes 2 * size hex digits (either case) into size bytes, false when any char is not a hex digit
+	static inline bool Decode(const char *in, size_t size, uint8_t *out) {
+		uint32_t invalid = 0;
+#ifdef QUACKECCAK_HEX_SSE2
+		int valid;
+		for (; size >= 8; size -= 8, in += 16, out += 8) {
+			const __m128i nibbles = DecodeNibbles(_mm_loadu_si128(reinterpret_cast<const __m128i *>(in)), valid);
+			invalid |= ~valid & 0xFFFF;
+			_mm_storel_epi64(reinterpret_cast<__m128i *>(out), PackNibbles(nibbles));
+		}
+		if (size >= 4) {
+			// Only the low 8 lanes of this load hold digits
+			const __m128i nibbles = DecodeNibbles(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(in)), valid);
+			invalid |= ~valid & 0xFF;
+			const auto packed = _mm_cvtsi128_si32(PackNibbles(nibbles));
+			memcpy(out, &packed, 4);
+			size -= 4;
+			in += 8;
+			out += 4;
+		}
+#endif
+		for (size_t i = 0; i < size; i++) {
+			const uint8_t hi = DECODE_TABLE[static_cast<uint8_t>(in[2 * i])];
+			const uint8_t lo = DECODE_TABLE[static_cast<uint8_t>(in[2 * i + 1])];
+			invalid |= (hi | lo) & INVALID;
+			out[i] = static_cast<uint8_t>(hi << 4 | (lo & 0x0F));
+		}
+		return invalid == 0;
+	}
+
+	// Encodes size bytes as 2 * size lowercase hex digits
+	static inline void Encode(const uint8_t *in, size_t size, char *out) {
+#ifdef QUACKECCAK_HEX_SSE2
+		for (; size >= 16; size -= 16, in += 16, out += 32) {
+			const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in));
+			const __m128i hi = _mm_and_si128(_mm_srli_epi16(bytes, 4), _mm_set1_epi8(0x0F));
+			const __m128i lo = _mm_and_si128(bytes, _mm_set1_epi8(0x0F));
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(out), NibblesToDigits(_mm_unpacklo_epi8(hi, lo)));
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(out + 16), NibblesToDigits(_mm_unpackhi_epi8(hi, lo)));
+		}
+		if (size >= 8) {
+			const __m128i bytes = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(in));
+			const __m128i hi = _mm_and_si128(_mm_srli_epi16(bytes, 4), _mm_set1_epi8(0x0F));
+			const __m128i lo = _mm_and_si128(bytes, _mm_set1_epi8(0x0F));
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(out), NibblesToDigits(_mm_unpacklo_epi8(hi, lo)));
+			size -= 8;
+			in += 8;
+			out += 16;
+		}
+		if (size >= 4) {
+			int32_t word;
+			memcpy(&word, in, 4);
+			const __m128i bytes = _mm_cvtsi32_si128(word);
+			const __m128i hi = _mm_and_si128(_mm_srli_epi16(bytes, 4), _mm_set1_epi8(0x0F));
+			const __m128i lo = _mm_and_si128(bytes, _mm_set1_epi8(0x0F));
+			_mm_storel_epi64(reinterpret_cast<__m128i *>(out), NibblesToDigits(_mm_unpacklo_epi8(hi, lo)));
+			size -= 4;
+			in += 4;
+			out += 8;
+		}
+#endif
+		for (size_t i = 0; i < size; i++) {
+			out[2 * i] = DIGITS[in[i] >> 4];
+			out[2 * i + 1] = DIGITS[in[i] & 0x0F];
+		}
+	}
+
+private:
+	static constexpr uint8_t INVALID = HexDecodeTable::INVALID;
+	static constexpr char DIGITS[] = "0123456789abcdef";
+	static constexpr HexDecodeTable DECODE_TABLE {};
+
+#ifdef QUACKECCAK_HEX_SSE2
+	// Nibble values of 16 chars, valid gets a bit per lane that holds a hex digit
+	static inline __m128i DecodeNibbles(__m128i chars, int &valid) {
+		const __m128i digit = _mm_sub_epi8(chars, _mm_set1_epi8('0'));
+		const __m128i alpha = _mm_sub_epi8(_mm_or_si128(chars, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+		// Unsigned x <= limit as min(x, limit) == x
+		const __m128i is_digit = _mm_cmpeq_epi8(_mm_min_epu8(digit, _mm_set1_epi8(9)), digit);
+		const __m128i is_alpha = _mm_cmpeq_epi8(_mm_min_epu8(alpha, _mm_set1_epi8(5)), alpha);
+		valid = _mm_movemask_epi8(_mm_or_si128(is_digit, is_alpha));
+		return _mm_or_si128(_mm_and_si128(is_digit, digit),
+		                    _mm_and_si128(is_alpha, _mm_add_epi8(alpha, _mm_set1_epi8(10))));
+	}
+
+	// Each 16-bit lane holds a (high, low) nibble pair, little-endian; the low 8 bytes get the packed bytes
+	static inline __m128i PackNibbles(__m128i nibbles) {
+		const __m128i hi = _mm_slli_epi16(_mm_and_si128(nibbles, _mm_set1_epi16(0x00FF)), 4);
+		const __m128i lo = _mm_srli_epi16(nibbles, 8);
+		return _mm_packus_epi16(_mm_or_si128(hi, lo), _mm_setzero_si128());
+	}
+
+	static inline __m128i NibblesToDigits(__m128i nibbles) {
+		const __m128i letters = _mm_and_si128(_mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9)), _mm_set1_epi8('a' - '0' - 10));
+		return _mm_add_epi8(_mm_add_epi8(nibbles, _mm_set1_epi8('0')), letters);
+	}
+#endif
+};
+
+} // namespace duckdb
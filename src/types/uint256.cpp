@@ -2,12 +2,14 @@
 #include "duckdb/common/types/blob.hpp"
 #include "duckdb/function/scalar_function.hpp"
 #include "fixed_bytes_utils.hpp"
+#include "uint256_kernels.hpp"
+#include "uint256_decimal.hpp"
 #include <intx.hpp>
 #include <cstring>
 
 namespace duckdb {
 
-static constexpr idx_t UINT256_SIZE = 32;
+static constexpr idx_t UINT256_SIZE = UINT256_BYTES;
 
 static LogicalType Uint256Type() {
 	LogicalType t(LogicalTypeId::BLOB);
@@ -15,93 +17,442 @@ static LogicalType Uint256Type() {
 	return t;
 }
 
+template <class SRC>
 static bool CastNumberToUint256(Vector &source, Vector &result, idx_t count, CastParameters &parameters) {
-	UnaryExecutor::Execute<int64_t, string_t>(source, result, count, [&](int64_t input) {
-		if (input < 0) {
-			throw InvalidInputException("Cannot cast negative number to uint256");
-		}
-		intx::uint256 val = input;
-		uint8_t bytes[UINT256_SIZE];
-		intx::be::store(bytes, val);
-		return StringVector::AddStringOrBlob(result, const_char_ptr_cast(bytes), UINT256_SIZE);
-	});
+	Uint256ResultWriter writer(result, count);
+	UnaryExecutor::ExecuteWithNulls<SRC, string_t>(
+	    source, result, count, [&](SRC input, ValidityMask &mask, idx_t idx) {
+		    if (input < 0) {
+			    throw InvalidInputException("Cannot cast negative number to uint256");
+		    }
+		    return writer.Encode(idx, intx::uint256(static_cast<uint64_t>(input)));
+	    });
 	return true;
 }
 
-static void AddOp(DataChunk &args, ExpressionState &state, Vector &result) {
-	BinaryExecutor::Execute<string_t, string_t, string_t>(
-	    args.data[0], args.data[1], result, args.size(), [&](const string_t &left, const string_t &right) {
-		    intx::uint256 a = intx::be::unsafe::load<intx::uint256>(reinterpret_cast<const uint8_t *>(left.GetData()));
-		    intx::uint256 b = intx::be::unsafe::load<intx::uint256>(reinterpret_cast<const uint8_t *>(right.GetData()));
-		    intx::uint256 sum = a + b;
-		    uint8_t out[UINT256_SIZE];
-		    intx::be::store(out, sum);
-		    return StringVector::AddStringOrBlob(result, const_char_ptr_cast(out), UINT256_SIZE);
-	    });
+static bool CastUnsignedToUint256(Vector &source, Vector &result, idx_t count, CastParameters &parameters) {
+	Uint256ResultWriter writer(result, count);
+	UnaryExecutor::ExecuteWithNulls<uint64_t, string_t>(
+	    source, result, count,
+	    [&](uint64_t input, ValidityMask &mask, idx_t idx) { return writer.Encode(idx, intx::uint256(input)); });
+	return true;
+}
+
+// '0x' prefixed input is always hex. Unprefixed input is hex for the VARCHAR cast, as for the other fixed-width
+// types, and an unsigned decimal integer for to_uint256.
+template <bool DECIMAL>
+static bool ParseUint256String(const char *p, idx_t len, data_ptr_t out) {
+	if (HasHexPrefix(p, len)) {
+		return ParseHexToFixedBytes<UINT256_SIZE>(p + 2, len - 2, out);
+	}
+	if (!DECIMAL) {
+		return ParseHexToFixedBytes<UINT256_SIZE>(p, len, out);
+	}
+	intx::uint256 value;
+	if (!ParseUint256Decimal(p, len, value)) {
+		return false;
+	}
+	intx::be::unsafe::store(out, value);
+	return true;
 }
 
-static void SubOp(DataChunk &args, ExpressionState &state, Vector &result) {
-	BinaryExecutor::Execute<string_t, string_t, string_t>(
-	    args.data[0], args.data[1], result, args.size(), [&](const string_t &left, const string_t &right) {
-		    intx::uint256 a = intx::be::unsafe::load<intx::uint256>(reinterpret_cast<const uint8_t *>(left.GetData()));
-		    intx::uint256 b = intx::be::unsafe::load<intx::uint256>(reinterpret_cast<const uint8_t *>(right.GetData()));
-		    intx::uint256 diff = a - b;
-		    uint8_t out[UINT256_SIZE];
-		    intx::be::store(out, diff);
-		    return StringVector::AddStringOrBlob(result, const_char_ptr_cast(out), UINT256_SIZE);
+template <bool DECIMAL>
+static void ParseVarcharToUint256(Vector &source, Vector &result, idx_t count) {
+	Uint256ResultWriter writer(result, count);
+	UnaryExecutor::ExecuteWithNulls<string_t, string_t>(
+	    source, result, count, [&](const string_t &input, ValidityMask &mask, idx_t idx) {
+		    if (!ParseUint256String<DECIMAL>(input.GetData(), input.GetSize(), writer.Slot(idx))) {
+			    mask.SetInvalid(idx);
+			    return string_t();
+		    }
+		    return writer.Get(idx);
 	    });
 }
 
-static void MulOp(DataChunk &args, ExpressionState &state, Vector &result) {
-	BinaryExecutor::Execute<string_t, string_t, string_t>(
-	    args.data[0], args.data[1], result, args.size(), [&](const string_t &left, const string_t &right) {
-		    intx::uint256 a = intx::be::unsafe::load<intx::uint256>(reinterpret_cast<const uint8_t *>(left.GetData()));
-		    intx::uint256 b = intx::be::unsafe::load<intx::uint256>(reinterpret_cast<const uint8_t *>(right.GetData()));
-		    intx::uint256 prod = a * b;
-		    uint8_t out[UINT256_SIZE];
-		    intx::be::store(out, prod);
-		    return StringVector::AddStringOrBlob(result, const_char_ptr_cast(out), UINT256_SIZE);
+static bool CastVarcharToUint256(Vector &source, Vector &result, idx_t count, CastParameters &parameters) {
+	ParseVarcharToUint256<false>(source, result, count);
+	return true;
+}
+
+static void ToUint256Function(DataChunk &args, ExpressionState &state, Vector &result) {
+	ParseVarcharToUint256<true>(args.data[0], result, args.size());
+}
+
+static idx_t CheckUnitDecimals(int32_t decimals) {
+	if (decimals < 0 || decimals >= static_cast<int32_t>(UINT256_MAX_DECIMAL_DIGITS)) {
+		throw InvalidInputException("decimals must be between 0 and %d", UINT256_MAX_DECIMAL_DIGITS - 1);
+	}
+	return static_cast<idx_t>(decimals);
+}
+
+// format_units(value, decimals): value / 10^decimals as a decimal string, trailing fractional zeros trimmed
+// down to a single digit (1000000 with 6 decimals is "1.0"), matching ethers' formatUnits
+static void FormatUnitsFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	BinaryExecutor::Execute<string_t, int32_t, string_t>(
+	    args.data[0], args.data[1], result, args.size(), [&](const string_t &input, int32_t decimals_p) {
+		    const auto decimals = CheckUnitDecimals(decimals_p);
+		    char digits[UINT256_MAX_DECIMAL_DIGITS];
+		    const auto len = FormatUint256Decimal(LoadUint256(input), digits);
+		    if (decimals == 0) {
+			    return StringVector::AddString(result, digits, len);
+		    }
+
+		    // Left-pad so there is at least one integer digit
+		    char out[UINT256_MAX_DECIMAL_DIGITS * 2 + 2];
+		    idx_t pos = 0;
+		    const idx_t padded_len = MaxValue<idx_t>(len, decimals + 1);
+		    const idx_t padding = padded_len - len;
+		    memset(out, '0', padding);
+		    memcpy(out + padding, digits, len);
+		    pos = padded_len;
+
+		    // Split off the fraction and trim it
+		    const idx_t int_len = padded_len - decimals;
+		    memmove(out + int_len + 1, out + int_len, decimals);
+		    out[int_len] = '.';
+		    pos++;
+		    while (pos > int_len + 2 && out[pos - 1] == '0') {
+			    pos--;
+		    }
+		    return StringVector::AddString(result, out, pos);
 	    });
 }
 
-static void DivOp(DataChunk &args, ExpressionState &state, Vector &result) {
-	BinaryExecutor::Execute<string_t, string_t, string_t>(
-	    args.data[0], args.data[1], result, args.size(), [&](const string_t &left, const string_t &right) {
-		    intx::uint256 a = intx::be::unsafe::load<intx::uint256>(reinterpret_cast<const uint8_t *>(left.GetData()));
-		    intx::uint256 b = intx::be::unsafe::load<intx::uint256>(reinterpret_cast<const uint8_t *>(right.GetData()));
-		    if (b == 0) {
-			    throw InvalidInputException("Division by zero");
+// parse_units(text, decimals): decimal string scaled by 10^decimals, NULL when malformed, when the fraction
+// has more than `decimals` significant digits or when the result does not fit 256 bits
+static void ParseUnitsFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	Uint256ResultWriter writer(result, args.size());
+	BinaryExecutor::ExecuteWithNulls<string_t, int32_t, string_t>(
+	    args.data[0], args.data[1], result, args.size(),
+	    [&](const string_t &input, int32_t decimals_p, ValidityMask &mask, idx_t idx) {
+		    const auto decimals = CheckUnitDecimals(decimals_p);
+		    const char *p = input.GetData();
+		    const idx_t len = input.GetSize();
+
+		    const char *dot = static_cast<const char *>(memchr(p, '.', len));
+		    idx_t int_len = dot ? static_cast<idx_t>(dot - p) : len;
+		    idx_t frac_len = dot ? len - int_len - 1 : 0;
+		    const char *frac = dot ? dot + 1 : nullptr;
+
+		    // Fractional digits beyond the unit precision are only allowed when they are zero
+		    while (frac_len > decimals && frac[frac_len - 1] == '0') {
+			    frac_len--;
+		    }
+		    if ((int_len == 0 && frac_len == 0) || frac_len > decimals ||
+		        int_len + decimals > UINT256_MAX_DECIMAL_DIGITS * 2) {
+			    mask.SetInvalid(idx);
+			    return string_t();
+		    }
+
+		    // Concatenate integer digits, fraction digits and zero padding, then parse as one integer
+		    char digits[UINT256_MAX_DECIMAL_DIGITS * 2 + 1];
+		    idx_t n = 0;
+		    if (int_len == 0) {
+			    digits[n++] = '0';
+		    }
+		    memcpy(digits + n, p, int_len);
+		    n += int_len;
+		    if (frac_len > 0) {
+			    memcpy(digits + n, frac, frac_len);
+			    n += frac_len;
+		    }
+		    memset(digits + n, '0', decimals - frac_len);
+		    n += decimals - frac_len;
+
+		    intx::uint256 value;
+		    if (!ParseUint256Decimal(digits, n, value)) {
+			    mask.SetInvalid(idx);
+			    return string_t();
 		    }
-		    intx::uint256 quot = a / b;
-		    uint8_t out[UINT256_SIZE];
-		    intx::be::store(out, quot);
-		    return StringVector::AddStringOrBlob(result, const_char_ptr_cast(out), UINT256_SIZE);
+		    return writer.Encode(idx, value);
 	    });
 }
 
+struct AddOperator {
+	template <class A, class B>
+	static inline intx::uint256 Operation(const A &a, const B &b) {
+		return a + b;
+	}
+};
+
+struct SubOperator {
+	template <class A, class B>
+	static inline intx::uint256 Operation(const A &a, const B &b) {
+		return a - b;
+	}
+};
+
+struct MulOperator {
+	template <class A, class B>
+	static inline intx::uint256 Operation(const A &a, const B &b) {
+		return a * b;
+	}
+};
+
+struct DivOperator {
+	template <class A, class B>
+	static inline intx::uint256 Operation(const A &a, const B &b) {
+		if (b == 0) {
+			throw InvalidInputException("Division by zero");
+		}
+		return a / b;
+	}
+};
+
+struct BitwiseAndOperator {
+	template <class A, class B>
+	static inline intx::uint256 Operation(const A &a, const B &b) {
+		return a & b;
+	}
+};
+
+struct BitwiseOrOperator {
+	template <class A, class B>
+	static inline intx::uint256 Operation(const A &a, const B &b) {
+		return a | b;
+	}
+};
+
+struct BitwiseXorOperator {
+	template <class A, class B>
+	static inline intx::uint256 Operation(const A &a, const B &b) {
+		return a ^ b;
+	}
+};
+
+struct ShiftLeftOperator {
+	template <class A, class B>
+	static inline intx::uint256 Operation(const A &a, const B &shift) {
+		return a << shift;
+	}
+};
+
+struct ShiftRightOperator {
+	template <class A, class B>
+	static inline intx::uint256 Operation(const A &a, const B &shift) {
+		return a >> shift;
+	}
+};
+
+struct ModOperator {
+	template <class A, class B>
+	static inline intx::uint256 Operation(const A &a, const B &b) {
+		if (b == 0) {
+			throw InvalidInputException("Division by zero");
+		}
+		return a % b;
+	}
+};
+
+// EVM EXP: wraps modulo 2^256
+struct ExpOperator {
+	template <class A, class B>
+	static inline intx::uint256 Operation(const A &a, const B &b) {
+		return intx::exp(a, b);
+	}
+};
+
+// Signed views interpret the 256 bits as two's complement int256, with EVM semantics (x / 0 == 0)
+struct SignedDivOperator {
+	template <class A, class B>
+	static inline intx::uint256 Operation(const A &a, const B &b) {
+		return b == 0 ? intx::uint256(0) : intx::sdivrem(a, b).quot;
+	}
+};
+
+struct SignedModOperator {
+	template <class A, class B>
+	static inline intx::uint256 Operation(const A &a, const B &b) {
+		return b == 0 ? intx::uint256(0) : intx::sdivrem(a, b).rem;
+	}
+};
+
+static inline bool IsNegative(const intx::uint256 &value) {
+	return (value[3] >> 63) != 0;
+}
+
+// sar(value, shift): arithmetic right shift, shifts of 256 or more saturate to 0 or -1
+struct ArithmeticShiftRightOperator {
+	template <class A, class B>
+	static inline intx::uint256 Operation(const A &value, const B &shift) {
+		const bool negative = IsNegative(value);
+		if (shift < 0 || shift >= 256) {
+			return negative ? ~intx::uint256(0) : intx::uint256(0);
+		}
+		auto shifted = value >> static_cast<uint64_t>(shift);
+		if (negative && shift > 0) {
+			shifted |= ~intx::uint256(0) << static_cast<uint64_t>(256 - shift);
+		}
+		return shifted;
+	}
+};
+
+// signextend(value, byte_index): EVM SIGNEXTEND, extends the sign bit of byte `byte_index` (0 = lowest)
+struct SignExtendOperator {
+	template <class A, class B>
+	static inline intx::uint256 Operation(const A &value, const B &byte_index) {
+		if (byte_index < 0 || byte_index >= 31) {
+			return value;
+		}
+		const auto bit = static_cast<uint64_t>(byte_index) * 8 + 7;
+		const auto mask = (intx::uint256(1) << (bit + 1)) - 1;
+		const bool negative = ((value >> bit)[0] & 1) != 0;
+		return negative ? (value | ~mask) : (value & mask);
+	}
+};
+
+// Checked variants return NULL instead of wrapping
+struct CheckedAddOperator {
+	template <class A, class B>
+	static inline bool Operation(const A &a, const B &b, intx::uint256 &out) {
+		const auto res = intx::addc(a, b);
+		out = res.value;
+		return !res.carry;
+	}
+};
+
+struct CheckedSubOperator {
+	template <class A, class B>
+	static inline bool Operation(const A &a, const B &b, intx::uint256 &out) {
+		const auto res = intx::subc(a, b);
+		out = res.value;
+		return !res.carry;
+	}
+};
+
+struct CheckedMulOperator {
+	template <class A, class B>
+	static inline bool Operation(const A &a, const B &b, intx::uint256 &out) {
+		const auto wide = intx::umul(a, b);
+		out = static_cast<intx::uint256>(wide);
+		return wide[4] == 0 && wide[5] == 0 && wide[6] == 0 && wide[7] == 0;
+	}
+};
+
+// EVM ADDMOD/MULMOD: intermediate results are not truncated, modulus 0 yields 0
+struct AddModOperator {
+	static inline intx::uint256 Operation(const intx::uint256 &a, const intx::uint256 &b, const intx::uint256 &m) {
+		return m == 0 ? intx::uint256(0) : intx::addmod(a, b, m);
+	}
+};
+
+struct MulModOperator {
+	static inline intx::uint256 Operation(const intx::uint256 &a, const intx::uint256 &b, const intx::uint256 &m) {
+		return m == 0 ? intx::uint256(0) : intx::mulmod(a, b, m);
+	}
+};
+
+struct BitwiseNotOperator {
+	static inline intx::uint256 Operation(const intx::uint256 &a) {
+		return ~a;
+	}
+};
+
+struct Uint256Equals {
+	static inline bool Operation(int cmp) {
+		return cmp == 0;
+	}
+};
+
+struct Uint256NotEquals {
+	static inline bool Operation(int cmp) {
+		return cmp != 0;
+	}
+};
+
+struct Uint256LessThan {
+	static inline bool Operation(int cmp) {
+		return cmp < 0;
+	}
+};
+
+struct Uint256LessThanEquals {
+	static inline bool Operation(int cmp) {
+		return cmp <= 0;
+	}
+};
+
+struct Uint256GreaterThan {
+	static inline bool Operation(int cmp) {
+		return cmp > 0;
+	}
+};
+
+struct Uint256GreaterThanEquals {
+	static inline bool Operation(int cmp) {
+		return cmp >= 0;
+	}
+};
+
+template <class OP>
+static void Uint256SignedCompareFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	BinaryExecutor::Execute<string_t, string_t, bool>(args.data[0], args.data[1], result, args.size(),
+	                                                  [](const string_t &left, const string_t &right) {
+		                                                  return OP::Operation(LoadUint256(left), LoadUint256(right));
+	                                                  });
+}
+
+struct SignedLessThan {
+	static inline bool Operation(const intx::uint256 &a, const intx::uint256 &b) {
+		return intx::slt(a, b);
+	}
+};
+
+struct SignedGreaterThan {
+	static inline bool Operation(const intx::uint256 &a, const intx::uint256 &b) {
+		return intx::slt(b, a);
+	}
+};
+
+template <class OP>
+static void Uint256CheckedFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	ExecuteUint256BinaryPartial<string_t, string_t, OP>(args, result);
+}
+
+template <class OP>
+static void Uint256TernaryFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	ExecuteUint256Ternary<OP>(args, result);
+}
+
+template <class OP>
+static void Uint256BinaryFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	ExecuteUint256Binary<string_t, string_t, OP>(args, result);
+}
+
+template <class OP>
+static void Uint256ShiftFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	ExecuteUint256Binary<string_t, int32_t, OP>(args, result);
+}
+
+// Plain comparison syntax binds to the native BLOB comparison (and with it radix sort, hash joins and
+// zonemap pruning), which is numerically correct for the fixed-width big-endian encoding. These overloads
+// serve the explicit function-call forms with the same memcmp semantics.
+template <class OP>
+static void Uint256CompareFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	BinaryExecutor::Execute<string_t, string_t, bool>(
+	    args.data[0], args.data[1], result, args.size(),
+	    [](const string_t &left, const string_t &right) { return OP::Operation(CompareUint256(left, right)); });
+}
+
 void RegisterUint256Type(DatabaseInstance &db) {
 	auto type = Uint256Type();
 	ExtensionUtil::RegisterType(db, "UINT256", type);
 
-	ExtensionUtil::RegisterCastFunction(db, LogicalType::VARCHAR, type,
-	                                    BoundCastInfo(CastVarcharToFixedBytes<UINT256_SIZE>), 1);
+	// VARCHAR <-> UINT256 is hex, with or without the 0x prefix; decimal text goes through to_uint256 or parse_units
+	ExtensionUtil::RegisterCastFunction(db, LogicalType::VARCHAR, type, BoundCastInfo(CastVarcharToUint256), 1);
 	ExtensionUtil::RegisterCastFunction(db, type, LogicalType::VARCHAR,
 	                                    BoundCastInfo(CastFixedBytesToVarchar<UINT256_SIZE>), 0);
 
-	ExtensionUtil::RegisterCastFunction(db, LogicalType::BIGINT, type, BoundCastInfo(CastNumberToUint256), 1);
-	ExtensionUtil::RegisterCastFunction(db, LogicalType::INTEGER, type, BoundCastInfo(CastNumberToUint256), 1);
-	ExtensionUtil::RegisterCastFunction(
-	    db, LogicalType::UBIGINT, type,
-	    BoundCastInfo([](Vector &source, Vector &result, idx_t count, CastParameters &parameters) {
-		    UnaryExecutor::Execute<uint64_t, string_t>(source, result, count, [&](uint64_t input) {
-			    intx::uint256 val = input;
-			    uint8_t bytes[UINT256_SIZE];
-			    intx::be::store(bytes, val);
-			    return StringVector::AddStringOrBlob(result, const_char_ptr_cast(bytes), UINT256_SIZE);
-		    });
-		    return true;
-	    }),
-	    1);
+	ExtensionUtil::RegisterCastFunction(db, LogicalType::BIGINT, type, BoundCastInfo(CastNumberToUint256<int64_t>), 1);
+	ExtensionUtil::RegisterCastFunction(db, LogicalType::INTEGER, type, BoundCastInfo(CastNumberToUint256<int32_t>),
+	                                    1);
+	ExtensionUtil::RegisterCastFunction(db, LogicalType::UBIGINT, type, BoundCastInfo(CastUnsignedToUint256), 1);
+
+	ExtensionUtil::RegisterFunction(db, ScalarFunction("to_uint256", {LogicalType::VARCHAR}, type, ToUint256Function));
+	ExtensionUtil::RegisterFunction(db, ScalarFunction("format_units", {type, LogicalType::INTEGER},
+	                                                   LogicalType::VARCHAR, FormatUnitsFunction));
+	ExtensionUtil::RegisterFunction(
+	    db, ScalarFunction("parse_units", {LogicalType::VARCHAR, LogicalType::INTEGER}, type, ParseUnitsFunction));
 
 	ExtensionUtil::RegisterCastFunction(
 	    db, type, LogicalType::BLOB,
@@ -111,132 +462,79 @@ void RegisterUint256Type(DatabaseInstance &db) {
 	    }),
 	    10);
 
-	ExtensionUtil::RegisterCastFunction(
-	    db, LogicalType::BLOB, type,
-	    BoundCastInfo([](Vector &source, Vector &result, idx_t count, CastParameters &parameters) {
-		    UnaryExecutor::ExecuteWithNulls<string_t, string_t>(
-		        source, result, count, [&](const string_t &input, ValidityMask &mask, idx_t idx) {
-			        if (input.GetSize() != UINT256_SIZE) {
-				        mask.SetInvalid(idx);
-				        return string_t();
-			        }
-			        return input;
-		        });
-		    return true;
-	    }),
-	    10);
+	ExtensionUtil::RegisterCastFunction(db, LogicalType::BLOB, type,
+	                                    BoundCastInfo(CastBlobToFixedBytes<UINT256_SIZE>), 10);
 
-	ExtensionUtil::RegisterFunction(db, ScalarFunction("+", {type, type}, type, AddOp));
-	ExtensionUtil::RegisterFunction(db, ScalarFunction("-", {type, type}, type, SubOp));
-	ExtensionUtil::RegisterFunction(db, ScalarFunction("*", {type, type}, type, MulOp));
-	ExtensionUtil::RegisterFunction(db, ScalarFunction("/", {type, type}, type, DivOp));
-
-	ExtensionUtil::RegisterFunction(
-	    db, ScalarFunction(
-	            "<", {type, type}, LogicalType::BOOLEAN, [](DataChunk &args, ExpressionState &state, Vector &result) {
-		            BinaryExecutor::Execute<string_t, string_t, bool>(
-		                args.data[0], args.data[1], result, args.size(), [](const string_t &l, const string_t &r) {
-			                intx::uint256 a =
-			                    intx::be::unsafe::load<intx::uint256>(reinterpret_cast<const uint8_t *>(l.GetData()));
-			                intx::uint256 b =
-			                    intx::be::unsafe::load<intx::uint256>(reinterpret_cast<const uint8_t *>(r.GetData()));
-			                return a < b;
-		                });
-	            }));
-
-	ExtensionUtil::RegisterFunction(
-	    db, ScalarFunction(
-	            "=", {type, type}, LogicalType::BOOLEAN, [](DataChunk &args, ExpressionState &state, Vector &result) {
-		            BinaryExecutor::Execute<string_t, string_t, bool>(
-		                args.data[0], args.data[1], result, args.size(), [](const string_t &l, const string_t &r) {
-			                intx::uint256 a =
-			                    intx::be::unsafe::load<intx::uint256>(reinterpret_cast<const uint8_t *>(l.GetData()));
-			                intx::uint256 b =
-			                    intx::be::unsafe::load<intx::uint256>(reinterpret_cast<const uint8_t *>(r.GetData()));
-			                return a == b;
-		                });
-	            }));
-
-	ExtensionUtil::RegisterFunction(
-	    db, ScalarFunction("&", {type, type}, type, [](DataChunk &args, ExpressionState &state, Vector &result) {
-		    BinaryExecutor::Execute<string_t, string_t, string_t>(
-		        args.data[0], args.data[1], result, args.size(), [&](const string_t &left, const string_t &right) {
-			        auto a = intx::be::unsafe::load<intx::uint256>(reinterpret_cast<const uint8_t *>(left.GetData()));
-			        auto b = intx::be::unsafe::load<intx::uint256>(reinterpret_cast<const uint8_t *>(right.GetData()));
-			        auto res = a & b;
-			        uint8_t out[32];
-			        intx::be::store(out, res);
-			        return StringVector::AddStringOrBlob(result, const_char_ptr_cast(out), 32);
-		        });
-	    }));
+	ExtensionUtil::RegisterFunction(db, ScalarFunction("+", {type, type}, type, Uint256BinaryFunction<AddOperator>));
+	ExtensionUtil::RegisterFunction(db, ScalarFunction("-", {type, type}, type, Uint256BinaryFunction<SubOperator>));
+	ExtensionUtil::RegisterFunction(db, ScalarFunction("*", {type, type}, type, Uint256BinaryFunction<MulOperator>));
+	ExtensionUtil::RegisterFunction(db, ScalarFunction("/", {type, type}, type, Uint256BinaryFunction<DivOperator>));
 
-	// Bitwise OR
 	ExtensionUtil::RegisterFunction(
-	    db, ScalarFunction("|", {type, type}, type, [](DataChunk &args, ExpressionState &state, Vector &result) {
-		    BinaryExecutor::Execute<string_t, string_t, string_t>(
-		        args.data[0], args.data[1], result, args.size(), [&](const string_t &left, const string_t &right) {
-			        auto a = intx::be::unsafe::load<intx::uint256>(reinterpret_cast<const uint8_t *>(left.GetData()));
-			        auto b = intx::be::unsafe::load<intx::uint256>(reinterpret_cast<const uint8_t *>(right.GetData()));
-			        auto res = a | b;
-			        uint8_t out[32];
-			        intx::be::store(out, res);
-			        return StringVector::AddStringOrBlob(result, const_char_ptr_cast(out), 32);
-		        });
-	    }));
+	    db, ScalarFunction("=", {type, type}, LogicalType::BOOLEAN, Uint256CompareFunction<Uint256Equals>));
+	ExtensionUtil::RegisterFunction(
+	    db, ScalarFunction("<>", {type, type}, LogicalType::BOOLEAN, Uint256CompareFunction<Uint256NotEquals>));
+	ExtensionUtil::RegisterFunction(
+	    db, ScalarFunction("<", {type, type}, LogicalType::BOOLEAN, Uint256CompareFunction<Uint256LessThan>));
+	ExtensionUtil::RegisterFunction(
+	    db, ScalarFunction("<=", {type, type}, LogicalType::BOOLEAN, Uint256CompareFunction<Uint256LessThanEquals>));
+	ExtensionUtil::RegisterFunction(
+	    db, ScalarFunction(">", {type, type}, LogicalType::BOOLEAN, Uint256CompareFunction<Uint256GreaterThan>));
+	ExtensionUtil::RegisterFunction(
+	    db, ScalarFunction(">=", {type, type}, LogicalType::BOOLEAN, Uint256CompareFunction<Uint256GreaterThanEquals>));
+
+	ExtensionUtil::RegisterFunction(db,
+	                                ScalarFunction("&", {type, type}, type, Uint256BinaryFunction<BitwiseAndOperator>));
+
+	// Bitwise OR
+	ExtensionUtil::RegisterFunction(db,
+	                                ScalarFunction("|", {type, type}, type, Uint256BinaryFunction<BitwiseOrOperator>));
 
 	ExtensionUtil::RegisterFunction(
-	    db, ScalarFunction("xor", {type, type}, type, [](DataChunk &args, ExpressionState &state, Vector &result) {
-		    BinaryExecutor::Execute<string_t, string_t, string_t>(
-		        args.data[0], args.data[1], result, args.size(), [&](const string_t &left, const string_t &right) {
-			        auto a = intx::be::unsafe::load<intx::uint256>(reinterpret_cast<const uint8_t *>(left.GetData()));
-			        auto b = intx::be::unsafe::load<intx::uint256>(reinterpret_cast<const uint8_t *>(right.GetData()));
-			        auto res = a ^ b; // intx supports ^
-			        uint8_t out[32];
-			        intx::be::store(out, res);
-			        return StringVector::AddStringOrBlob(result, const_char_ptr_cast(out), 32);
-		        });
-	    }));
+	    db, ScalarFunction("xor", {type, type}, type, Uint256BinaryFunction<BitwiseXorOperator>));
 
 	// Left shift
 	ExtensionUtil::RegisterFunction(
-	    db, ScalarFunction(
-	            "<<", {type, LogicalType::INTEGER}, type, [](DataChunk &args, ExpressionState &state, Vector &result) {
-		            BinaryExecutor::Execute<string_t, int32_t, string_t>(
-		                args.data[0], args.data[1], result, args.size(), [&](const string_t &left, int32_t shift) {
-			                auto a = intx::be::unsafe::load<intx::uint256>(
-			                    reinterpret_cast<const uint8_t *>(left.GetData()));
-			                auto res = a << shift;
-			                uint8_t out[32];
-			                intx::be::store(out, res);
-			                return StringVector::AddStringOrBlob(result, const_char_ptr_cast(out), 32);
-		                });
-	            }));
+	    db, ScalarFunction("<<", {type, LogicalType::INTEGER}, type, Uint256ShiftFunction<ShiftLeftOperator>));
 
 	// Right shift
 	ExtensionUtil::RegisterFunction(
-	    db, ScalarFunction(
-	            ">>", {type, LogicalType::INTEGER}, type, [](DataChunk &args, ExpressionState &state, Vector &result) {
-		            BinaryExecutor::Execute<string_t, int32_t, string_t>(
-		                args.data[0], args.data[1], result, args.size(), [&](const string_t &left, int32_t shift) {
-			                auto a = intx::be::unsafe::load<intx::uint256>(
-			                    reinterpret_cast<const uint8_t *>(left.GetData()));
-			                auto res = a >> shift;
-			                uint8_t out[32];
-			                intx::be::store(out, res);
-			                return StringVector::AddStringOrBlob(result, const_char_ptr_cast(out), 32);
-		                });
-	            }));
+	    db, ScalarFunction(">>", {type, LogicalType::INTEGER}, type, Uint256ShiftFunction<ShiftRightOperator>));
+
+	ExtensionUtil::RegisterFunction(db, ScalarFunction("%", {type, type}, type, Uint256BinaryFunction<ModOperator>));
+	ExtensionUtil::RegisterFunction(db, ScalarFunction("**", {type, type}, type, Uint256BinaryFunction<ExpOperator>));
+	ExtensionUtil::RegisterFunction(db, ScalarFunction("^", {type, type}, type, Uint256BinaryFunction<ExpOperator>));
+
+	ExtensionUtil::RegisterFunction(
+	    db, ScalarFunction("addmod", {type, type, type}, type, Uint256TernaryFunction<AddModOperator>));
+	ExtensionUtil::RegisterFunction(
+	    db, ScalarFunction("mulmod", {type, type, type}, type, Uint256TernaryFunction<MulModOperator>));
+
+	ExtensionUtil::RegisterFunction(
+	    db, ScalarFunction("checked_add", {type, type}, type, Uint256CheckedFunction<CheckedAddOperator>));
+	ExtensionUtil::RegisterFunction(
+	    db, ScalarFunction("checked_sub", {type, type}, type, Uint256CheckedFunction<CheckedSubOperator>));
+	ExtensionUtil::RegisterFunction(
+	    db, ScalarFunction("checked_mul", {type, type}, type, Uint256CheckedFunction<CheckedMulOperator>));
+
+	// Signed int256 views
+	ExtensionUtil::RegisterFunction(
+	    db, ScalarFunction("sdiv", {type, type}, type, Uint256BinaryFunction<SignedDivOperator>));
+	ExtensionUtil::RegisterFunction(
+	    db, ScalarFunction("smod", {type, type}, type, Uint256BinaryFunction<SignedModOperator>));
+	ExtensionUtil::RegisterFunction(db, ScalarFunction("sar", {type, LogicalType::INTEGER}, type,
+	                                                   Uint256ShiftFunction<ArithmeticShiftRightOperator>));
+	ExtensionUtil::RegisterFunction(db, ScalarFunction("signextend", {type, LogicalType::INTEGER}, type,
+	                                                   Uint256ShiftFunction<SignExtendOperator>));
+	ExtensionUtil::RegisterFunction(db, ScalarFunction("slt", {type, type}, LogicalType::BOOLEAN,
+	                                                   Uint256SignedCompareFunction<SignedLessThan>));
+	ExtensionUtil::RegisterFunction(db, ScalarFunction("sgt", {type, type}, LogicalType::BOOLEAN,
+	                                                   Uint256SignedCompareFunction<SignedGreaterThan>));
 
 	// Bitwise NOT
 	ExtensionUtil::RegisterFunction(
 	    db, ScalarFunction("~", {type}, type, [](DataChunk &args, ExpressionState &state, Vector &result) {
-		    UnaryExecutor::Execute<string_t, string_t>(args.data[0], result, args.size(), [&](const string_t &input) {
-			    auto a = intx::be::unsafe::load<intx::uint256>(reinterpret_cast<const uint8_t *>(input.GetData()));
-			    auto res = ~a;
-			    uint8_t out[32];
-			    intx::be::store(out, res);
-			    return StringVector::AddStringOrBlob(result, const_char_ptr_cast(out), 32);
-		    });
+		    ExecuteUint256Unary<BitwiseNotOperator>(args, result);
 	    }));
 }
 
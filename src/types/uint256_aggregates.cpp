@@ -0,0 +1,198 @@
+#include "uint256_aggregates.hpp"
+#include "uint256_kernels.hpp"
+#include "duckdb/catalog/catalog.hpp"
+#include "duckdb/catalog/catalog_entry/aggregate_function_catalog_entry.hpp"
+#include "duckdb/function/aggregate_function.hpp"
+#include "duckdb/parser/parsed_data/create_aggregate_function_info.hpp"
+#include "duckdb/main/connection.hpp"
+#include <intx.hpp>
+
+namespace duckdb {
+
+static LogicalType Uint256Type() {
+	LogicalType t(LogicalTypeId::BLOB);
+	t.SetAlias("UINT256");
+	return t;
+}
+
+// 320 bits hold the sum of 2^64 maximal uint256 values, so the accumulator itself can never wrap.
+// Only the final narrowing back to 256 bits is checked.
+struct Uint256SumState {
+	intx::uint320 sum;
+	uint64_t count;
+};
+
+struct Uint256BitState {
+	intx::uint256 value;
+	bool is_set;
+};
+
+static void FinalizeUint256(Vector &result, string_t &target, const intx::uint256 &value) {
+	uint8_t bytes[UINT256_BYTES];
+	intx::be::unsafe::store(bytes, value);
+	target = StringVector::AddStringOrBlob(result, const_char_ptr_cast(bytes), UINT256_BYTES);
+}
+
+static intx::uint256 NarrowSum(const intx::uint320 &sum) {
+	if (sum[4] != 0) {
+		throw OutOfRangeException("UINT256 sum out of range");
+	}
+	return static_cast<intx::uint256>(sum);
+}
+
+struct Uint256SumBaseOperation {
+	template <class STATE>
+	static void Initialize(STATE &state) {
+		state.sum = 0;
+		state.count = 0;
+	}
+
+	template <class INPUT_TYPE, class STATE, class OP>
+	static void Operation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &) {
+		state.sum += intx::uint320(LoadUint256(input));
+		state.count++;
+	}
+
+	template <class INPUT_TYPE, class STATE, class OP>
+	static void ConstantOperation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &, idx_t count) {
+		state.sum += intx::uint320(LoadUint256(input)) * intx::uint320(count);
+		state.count += count;
+	}
+
+	template <class STATE, class OP>
+	static void Combine(const STATE &source, STATE &target, AggregateInputData &) {
+		target.sum += source.sum;
+		target.count += source.count;
+	}
+
+	static bool IgnoreNull() {
+		return true;
+	}
+};
+
+struct Uint256SumOperation : public Uint256SumBaseOperation {
+	template <class T, class STATE>
+	static void Finalize(STATE &state, T &target, AggregateFinalizeData &finalize_data) {
+		if (state.count == 0) {
+			finalize_data.ReturnNull();
+			return;
+		}
+		FinalizeUint256(finalize_data.result, target, NarrowSum(state.sum));
+	}
+};
+
+// Integer average, truncated towards zero like the EVM division
+struct Uint256AvgOperation : public Uint256SumBaseOperation {
+	template <class T, class STATE>
+	static void Finalize(STATE &state, T &target, AggregateFinalizeData &finalize_data) {
+		if (state.count == 0) {
+			finalize_data.ReturnNull();
+			return;
+		}
+		auto avg = state.sum / intx::uint320(state.count);
+		FinalizeUint256(finalize_data.result, target, static_cast<intx::uint256>(avg));
+	}
+};
+
+template <class OP>
+struct Uint256BitOperation {
+	template <class STATE>
+	static void Initialize(STATE &state) {
+		state.value = 0;
+		state.is_set = false;
+	}
+
+	template <class INPUT_TYPE, class STATE, class BASE_OP>
+	static void Operation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &) {
+		auto value = LoadUint256(input);
+		state.value = state.is_set ? OP::Apply(state.value, value) : value;
+		state.is_set = true;
+	}
+
+	template <class INPUT_TYPE, class STATE, class BASE_OP>
+	static void ConstantOperation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &unary_input, idx_t) {
+		// x | x == x and x & x == x, so a constant run folds in once
+		Operation<INPUT_TYPE, STATE, BASE_OP>(state, input, unary_input);
+	}
+
+	template <class STATE, class BASE_OP>
+	static void Combine(const STATE &source, STATE &target, AggregateInputData &) {
+		if (!source.is_set) {
+			return;
+		}
+		target.value = target.is_set ? OP::Apply(target.value, source.value) : source.value;
+		target.is_set = true;
+	}
+
+	template <class T, class STATE>
+	static void Finalize(STATE &state, T &target, AggregateFinalizeData &finalize_data) {
+		if (!state.is_set) {
+			finalize_data.ReturnNull();
+			return;
+		}
+		FinalizeUint256(finalize_data.result, target, state.value);
+	}
+
+	static bool IgnoreNull() {
+		return true;
+	}
+};
+
+struct BitOrApply {
+	static inline intx::uint256 Apply(const intx::uint256 &a, const intx::uint256 &b) {
+		return a | b;
+	}
+};
+
+struct BitAndApply {
+	static inline intx::uint256 Apply(const intx::uint256 &a, const intx::uint256 &b) {
+		return a & b;
+	}
+};
+
+// sum/avg/bit_or/bit_and already exist as built-in aggregates and aggregate registration does not merge
+// overloads, so each is re-created as a set holding the built-in overloads plus the UINT256 one
+static void AddAggregateOverload(DatabaseInstance &db, AggregateFunction function) {
+	AggregateFunctionSet set(function.name);
+	Connection con(db);
+	con.BeginTransaction();
+	auto &catalog = Catalog::GetSystemCatalog(*con.context);
+	auto entry = catalog.GetEntry<AggregateFunctionCatalogEntry>(*con.context, DEFAULT_SCHEMA, function.name,
+	                                                             OnEntryNotFound::RETURN_NULL);
+	if (entry) {
+		for (auto &existing : entry->functions.functions) {
+			set.AddFunction(existing);
+		}
+	}
+	set.AddFunction(std::move(function));
+
+	CreateAggregateFunctionInfo info(std::move(set));
+	info.internal = true;
+	info.on_conflict = OnCreateConflict::REPLACE_ON_CONFLICT;
+	catalog.CreateFunction(*con.context, info);
+	con.Commit();
+}
+
+void RegisterUint256Aggregates(DatabaseInstance &db) {
+	auto type = Uint256Type();
+
+	auto sum = AggregateFunction::UnaryAggregate<Uint256SumState, string_t, string_t, Uint256SumOperation>(type, type);
+	sum.name = "sum";
+	AddAggregateOverload(db, sum);
+
+	auto avg = AggregateFunction::UnaryAggregate<Uint256SumState, string_t, string_t, Uint256AvgOperation>(type, type);
+	avg.name = "avg";
+	AddAggregateOverload(db, avg);
+
+	auto bit_or = AggregateFunction::UnaryAggregate<Uint256BitState, string_t, string_t,
+	                                                Uint256BitOperation<BitOrApply>>(type, type);
+	bit_or.name = "bit_or";
+	AddAggregateOverload(db, bit_or);
+
+	auto bit_and = AggregateFunction::UnaryAggregate<Uint256BitState, string_t, string_t,
+	                                                 Uint256BitOperation<BitAndApply>>(type, type);
+	bit_and.name = "bit_and";
+	AddAggregateOverload(db, bit_and);
+}
+
+} // namespace duckdb
@@ -0,0 +1,9 @@
+#pragma once
+
+#include "duckdb.hpp"
+
+namespace duckdb {
+
+void RegisterUint256Aggregates(DatabaseInstance &db);
+
+} // namespace duckdb
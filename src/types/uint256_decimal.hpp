@@ -0,0 +1,184 @@
+#pragma once
+
+#include <intx.hpp>
+#include <cstdint>
+#include <cstring>
+
+namespace duckdb {
+
+// Largest power of ten that fits a 64-bit word; decimal I/O works in 19-digit chunks of it
+static constexpr uint64_t UINT256_DECIMAL_CHUNK = 10000000000000000000ULL;
+static constexpr size_t UINT256_DECIMAL_CHUNK_DIGITS = 19;
+static constexpr size_t UINT256_MAX_DECIMAL_DIGITS = 78;
+
+static constexpr uint64_t UINT256_POW10[20] = {1ULL,
+                                               10ULL,
+                                               100ULL,
+                                               1000ULL,
+                                               10000ULL,
+                                               100000ULL,
+                                               1000000ULL,
+                                               10000000ULL,
+                                               100000000ULL,
+                                               1000000000ULL,
+                                               10000000000ULL,
+                                               100000000000ULL,
+                                               1000000000000ULL,
+                                               10000000000000ULL,
+                                               100000000000000ULL,
+                                               1000000000000000ULL,
+                                               10000000000000000ULL,
+                                               100000000000000000ULL,
+                                               1000000000000000000ULL,
+                                               10000000000000000000ULL};
+
+static constexpr char DECIMAL_DIGIT_PAIRS[] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+// value = value * mul + add, false when the result does not fit 256 bits
+static inline bool Uint256MulAddWord(intx::uint256 &value, uint64_t mul, uint64_t add) {
+	uint64_t carry = add;
+	for (size_t i = 0; i < intx::uint256::num_words; i++) {
+		const auto p = intx::umul(value[i], mul) + intx::uint128 {carry};
+		value[i] = p[0];
+		carry = p[1];
+	}
+	return carry == 0;
+}
+
+// SWAR check and conversion of eight ASCII digits at once
+static inline bool ParseEightDigits(const char *p, uint64_t &out) {
+	uint64_t chunk;
+	memcpy(&chunk, p, sizeof(chunk));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	chunk = __builtin_bswap64(chunk);
+#endif
+	// Every byte must be in '0'..'9': high nibble 3 and no carry out of the low nibble when adding 6
+	if ((((chunk & 0xF0F0F0F0F0F0F0F0ULL) | (((chunk + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4))) !=
+	    0x3333333333333333ULL) {
+		return false;
+	}
+	chunk = ((chunk & 0x0F0F0F0F0F0F0F0FULL) * 2561) >> 8;
+	chunk = ((chunk & 0x00FF00FF00FF00FFULL) * 6553601) >> 16;
+	chunk = ((chunk & 0x0000FFFF0000FFFFULL) * 42949672960001ULL) >> 32;
+	out = chunk;
+	return true;
+}
+
+static inline bool ParseDigitRun(const char *p, size_t len, uint64_t &out) {
+	uint64_t value = 0;
+	size_t i = 0;
+	for (; i + 8 <= len; i += 8) {
+		uint64_t eight;
+		if (!ParseEightDigits(p + i, eight)) {
+			return false;
+		}
+		value = value * 100000000ULL + eight;
+	}
+	for (; i < len; i++) {
+		const auto d = static_cast<uint8_t>(p[i] - '0');
+		if (d > 9) {
+			return false;
+		}
+		value = value * 10 + d;
+	}
+	out = value;
+	return true;
+}
+
+// Parses an unsigned decimal integer, false on empty input, non-digits or overflow
+static inline bool ParseUint256Decimal(const char *p, size_t len, intx::uint256 &out) {
+	if (len == 0) {
+		return false;
+	}
+	// Leading zeros never contribute, skipping them keeps the length check meaningful
+	while (len > 1 && *p == '0') {
+		p++;
+		len--;
+	}
+	if (len > UINT256_MAX_DECIMAL_DIGITS) {
+		return false;
+	}
+
+	intx::uint256 value = 0;
+	// First chunk takes the remainder so the rest are full 19-digit words
+	size_t head = len % UINT256_DECIMAL_CHUNK_DIGITS;
+	if (head == 0) {
+		head = UINT256_DECIMAL_CHUNK_DIGITS;
+	}
+	uint64_t chunk;
+	if (!ParseDigitRun(p, head, chunk)) {
+		return false;
+	}
+	value[0] = chunk;
+	for (size_t i = head; i < len; i += UINT256_DECIMAL_CHUNK_DIGITS) {
+		if (!ParseDigitRun(p + i, UINT256_DECIMAL_CHUNK_DIGITS, chunk) ||
+		    !Uint256MulAddWord(value, UINT256_DECIMAL_CHUNK, chunk)) {
+			return false;
+		}
+	}
+	out = value;
+	return true;
+}
+
+// Writes exactly `width` digits of value (< 10^width), zero padded on the left
+static inline void WriteDigitsPadded(uint64_t value, char *out, size_t width) {
+	size_t pos = width;
+	while (pos >= 2) {
+		const auto pair = (value % 100) * 2;
+		value /= 100;
+		pos -= 2;
+		out[pos] = DECIMAL_DIGIT_PAIRS[pair];
+		out[pos + 1] = DECIMAL_DIGIT_PAIRS[pair + 1];
+	}
+	if (pos == 1) {
+		out[0] = static_cast<char>('0' + value % 10);
+	}
+}
+
+static inline size_t CountDigits(uint64_t value) {
+	size_t digits = 1;
+	while (digits < 20 && value >= UINT256_POW10[digits]) {
+		digits++;
+	}
+	return digits;
+}
+
+// Formats value into out (at least UINT256_MAX_DECIMAL_DIGITS bytes), returns the number of digits
+static inline size_t FormatUint256Decimal(intx::uint256 value, char *out) {
+	// Split into 19-digit words, least significant first, one division per word instead of one per digit
+	uint64_t chunks[5];
+	size_t num_chunks = 0;
+	const intx::uint256 divisor = UINT256_DECIMAL_CHUNK;
+	while (value[3] != 0 || value[2] != 0 || value[1] != 0) {
+		const auto res = intx::udivrem(value, divisor);
+		chunks[num_chunks++] = static_cast<uint64_t>(res.rem);
+		value = res.quot;
+	}
+	// value now fits one word, which may still hold up to 20 digits
+	if (value[0] >= UINT256_DECIMAL_CHUNK) {
+		chunks[num_chunks++] = value[0] % UINT256_DECIMAL_CHUNK;
+		value[0] /= UINT256_DECIMAL_CHUNK;
+	}
+	const uint64_t top = value[0];
+
+	size_t len = 0;
+	if (top != 0 || num_chunks == 0) {
+		len = CountDigits(top);
+		WriteDigitsPadded(top, out, len);
+	} else {
+		// Top word is zero, the most significant chunk is printed without padding
+		const auto head = chunks[--num_chunks];
+		len = CountDigits(head);
+		WriteDigitsPadded(head, out, len);
+	}
+	while (num_chunks > 0) {
+		WriteDigitsPadded(chunks[--num_chunks], out + len, UINT256_DECIMAL_CHUNK_DIGITS);
+		len += UINT256_DECIMAL_CHUNK_DIGITS;
+	}
+	return len;
+}
+
+} // namespace duckdb
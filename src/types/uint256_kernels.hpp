@@ -0,0 +1,240 @@
+#pragma once
+
+#include "duckdb/main/extension_util.hpp"
+#include "duckdb/common/types/blob.hpp"
+#include "duckdb/function/scalar_function.hpp"
+#include <intx.hpp>
+#include <cstring>
+
+namespace duckdb {
+
+static constexpr idx_t UINT256_BYTES = 32;
+
+// Rows are decoded into small tiles so the operation loop runs over plain intx arrays that stay in L1
+static constexpr idx_t UINT256_TILE_SIZE = 64;
+
+static inline intx::uint256 LoadUint256(const string_t &blob) {
+	if (blob.GetSize() != UINT256_BYTES) {
+		throw InvalidInputException("Invalid uint256 size");
+	}
+	return intx::be::unsafe::load<intx::uint256>(const_data_ptr_cast(blob.GetData()));
+}
+
+// Big-endian fixed width is order-preserving, so comparisons never need to decode
+static inline int CompareUint256(const string_t &left, const string_t &right) {
+	if (left.GetSize() != UINT256_BYTES || right.GetSize() != UINT256_BYTES) {
+		throw InvalidInputException("Invalid uint256 size");
+	}
+	return memcmp(left.GetData(), right.GetData(), UINT256_BYTES);
+}
+
+// Fixed-width result storage for a whole chunk: a single string heap allocation of count * 32 bytes,
+// every row is a string_t pointing at its 32-byte slice instead of a separate AddStringOrBlob copy
+class Uint256ResultWriter {
+public:
+	Uint256ResultWriter(Vector &result, idx_t count) : result_data(FlatVector::GetData<string_t>(result)) {
+		if (count > 0) {
+			auto block = StringVector::EmptyString(result, count * UINT256_BYTES);
+			base = data_ptr_cast(block.GetDataWriteable());
+		}
+	}
+
+	inline data_ptr_t Slot(idx_t row) const {
+		return base + row * UINT256_BYTES;
+	}
+
+	// Returns the string_t for a slot that has been filled in place
+	inline string_t Get(idx_t row) const {
+		return string_t(const_char_ptr_cast(Slot(row)), UINT256_BYTES);
+	}
+
+	inline string_t Encode(idx_t row, const intx::uint256 &value) {
+		intx::be::unsafe::store(Slot(row), value);
+		return Get(row);
+	}
+
+	inline void Store(idx_t row, const intx::uint256 &value) {
+		result_data[row] = Encode(row, value);
+	}
+
+private:
+	string_t *result_data;
+	data_ptr_t base = nullptr;
+};
+
+static inline void SetConstantUint256(Vector &result, const intx::uint256 &value) {
+	result.SetVectorType(VectorType::CONSTANT_VECTOR);
+	auto target = StringVector::EmptyString(result, UINT256_BYTES);
+	intx::be::unsafe::store(data_ptr_cast(target.GetDataWriteable()), value);
+	target.Finalize();
+	ConstantVector::GetData<string_t>(result)[0] = target;
+}
+
+// Storage type -> decoded operand type. UINT256 blobs decode to intx, everything else passes through
+template <class T>
+struct Uint256Operand {
+	using TYPE = T;
+	static inline T Load(const T &input) {
+		return input;
+	}
+};
+
+template <>
+struct Uint256Operand<string_t> {
+	using TYPE = intx::uint256;
+	static inline intx::uint256 Load(const string_t &input) {
+		return LoadUint256(input);
+	}
+};
+
+// Adapts an operator that always produces a value to the partial (NULL-producing) operator interface
+template <class OP>
+struct Uint256TotalOperator {
+	template <class A, class B>
+	static inline bool Operation(const A &a, const B &b, intx::uint256 &out) {
+		out = OP::template Operation<A, B>(a, b);
+		return true;
+	}
+};
+
+// OP::Operation(a, b, out) returns false to make the row NULL (e.g. checked arithmetic on overflow)
+template <class A_TYPE, class B_TYPE, class OP>
+static void ExecuteUint256BinaryPartial(DataChunk &args, Vector &result) {
+	using A = typename Uint256Operand<A_TYPE>::TYPE;
+	using B = typename Uint256Operand<B_TYPE>::TYPE;
+
+	auto &left = args.data[0];
+	auto &right = args.data[1];
+	const idx_t count = args.size();
+
+	if (left.GetVectorType() == VectorType::CONSTANT_VECTOR && right.GetVectorType() == VectorType::CONSTANT_VECTOR) {
+		intx::uint256 out;
+		if (ConstantVector::IsNull(left) || ConstantVector::IsNull(right) ||
+		    !OP::template Operation<A, B>(Uint256Operand<A_TYPE>::Load(ConstantVector::GetData<A_TYPE>(left)[0]),
+		                                  Uint256Operand<B_TYPE>::Load(ConstantVector::GetData<B_TYPE>(right)[0]),
+		                                  out)) {
+			result.SetVectorType(VectorType::CONSTANT_VECTOR);
+			ConstantVector::SetNull(result, true);
+			return;
+		}
+		SetConstantUint256(result, out);
+		return;
+	}
+
+	UnifiedVectorFormat left_fmt, right_fmt;
+	left.ToUnifiedFormat(count, left_fmt);
+	right.ToUnifiedFormat(count, right_fmt);
+	auto left_data = UnifiedVectorFormat::GetData<A_TYPE>(left_fmt);
+	auto right_data = UnifiedVectorFormat::GetData<B_TYPE>(right_fmt);
+
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto &validity = FlatVector::Validity(result);
+	Uint256ResultWriter writer(result, count);
+
+	A a[UINT256_TILE_SIZE];
+	B b[UINT256_TILE_SIZE];
+	intx::uint256 out[UINT256_TILE_SIZE];
+	bool valid[UINT256_TILE_SIZE];
+	idx_t rows[UINT256_TILE_SIZE];
+
+	for (idx_t tile_start = 0; tile_start < count; tile_start += UINT256_TILE_SIZE) {
+		const idx_t tile_end = MinValue<idx_t>(tile_start + UINT256_TILE_SIZE, count);
+
+		// Gather the valid rows of this tile
+		idx_t n = 0;
+		for (idx_t row = tile_start; row < tile_end; row++) {
+			auto lidx = left_fmt.sel->get_index(row);
+			auto ridx = right_fmt.sel->get_index(row);
+			if (!left_fmt.validity.RowIsValid(lidx) || !right_fmt.validity.RowIsValid(ridx)) {
+				validity.SetInvalid(row);
+				continue;
+			}
+			a[n] = Uint256Operand<A_TYPE>::Load(left_data[lidx]);
+			b[n] = Uint256Operand<B_TYPE>::Load(right_data[ridx]);
+			rows[n] = row;
+			n++;
+		}
+
+		for (idx_t i = 0; i < n; i++) {
+			valid[i] = OP::template Operation<A, B>(a[i], b[i], out[i]);
+		}
+
+		for (idx_t i = 0; i < n; i++) {
+			if (valid[i]) {
+				writer.Store(rows[i], out[i]);
+			} else {
+				validity.SetInvalid(rows[i]);
+			}
+		}
+	}
+}
+
+template <class A_TYPE, class B_TYPE, class OP>
+static void ExecuteUint256Binary(DataChunk &args, Vector &result) {
+	ExecuteUint256BinaryPartial<A_TYPE, B_TYPE, Uint256TotalOperator<OP>>(args, result);
+}
+
+// Three UINT256 operands (addmod/mulmod)
+template <class OP>
+static void ExecuteUint256Ternary(DataChunk &args, Vector &result) {
+	const idx_t count = args.size();
+	UnifiedVectorFormat fmt[3];
+	const string_t *data[3];
+	for (idx_t col = 0; col < 3; col++) {
+		args.data[col].ToUnifiedFormat(count, fmt[col]);
+		data[col] = UnifiedVectorFormat::GetData<string_t>(fmt[col]);
+	}
+
+	auto &validity = FlatVector::Validity(result);
+	Uint256ResultWriter writer(result, count);
+	for (idx_t row = 0; row < count; row++) {
+		auto aidx = fmt[0].sel->get_index(row);
+		auto bidx = fmt[1].sel->get_index(row);
+		auto cidx = fmt[2].sel->get_index(row);
+		if (!fmt[0].validity.RowIsValid(aidx) || !fmt[1].validity.RowIsValid(bidx) ||
+		    !fmt[2].validity.RowIsValid(cidx)) {
+			validity.SetInvalid(row);
+			continue;
+		}
+		writer.Store(row, OP::Operation(LoadUint256(data[0][aidx]), LoadUint256(data[1][bidx]),
+		                                LoadUint256(data[2][cidx])));
+	}
+	if (args.AllConstant()) {
+		result.SetVectorType(VectorType::CONSTANT_VECTOR);
+	}
+}
+
+template <class OP>
+static void ExecuteUint256Unary(DataChunk &args, Vector &result) {
+	auto &input = args.data[0];
+	const idx_t count = args.size();
+
+	if (input.GetVectorType() == VectorType::CONSTANT_VECTOR) {
+		if (ConstantVector::IsNull(input)) {
+			result.SetVectorType(VectorType::CONSTANT_VECTOR);
+			ConstantVector::SetNull(result, true);
+			return;
+		}
+		SetConstantUint256(result, OP::Operation(LoadUint256(ConstantVector::GetData<string_t>(input)[0])));
+		return;
+	}
+
+	UnifiedVectorFormat fmt;
+	input.ToUnifiedFormat(count, fmt);
+	auto input_data = UnifiedVectorFormat::GetData<string_t>(fmt);
+
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto &validity = FlatVector::Validity(result);
+	Uint256ResultWriter writer(result, count);
+
+	for (idx_t row = 0; row < count; row++) {
+		auto idx = fmt.sel->get_index(row);
+		if (!fmt.validity.RowIsValid(idx)) {
+			validity.SetInvalid(row);
+			continue;
+		}
+		writer.Store(row, OP::Operation(LoadUint256(input_data[idx])));
+	}
+}
+
+} // namespace duckdb